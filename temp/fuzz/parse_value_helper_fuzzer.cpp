@@ -0,0 +1,131 @@
+#include <nlohmann/json.hpp>
+#include "json_utils.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+using namespace redfish::json_util::details;
+
+namespace {
+
+// Inputs shorter than this are dominated by timer and allocator noise, so
+// they are not checked against the per-byte budget.
+constexpr std::size_t minTimedInputSize = 64;
+
+// Budget for one input across all destination shapes, in nanoseconds per
+// input byte. Linear inputs stay well below the default in an ASan build;
+// override with FUZZ_MAX_NS_PER_BYTE.
+double maxNsPerByte() {
+    static const double limit = [] {
+        const char* env = std::getenv("FUZZ_MAX_NS_PER_BYTE");
+        return env != nullptr ? std::atof(env) : 20000.0;
+    }();
+    return limit;
+}
+
+using ComplexVariant = std::variant<
+    std::string, int, bool, double,
+    nlohmann::json::object_t,
+    std::vector<int>,
+    std::vector<std::string>,
+    std::vector<bool>,
+    std::vector<double>>;
+
+template <typename Type>
+void unpackOne(const nlohmann::json& input) {
+    // parseValueHelper may move out of its input, so each shape gets a copy.
+    nlohmann::json jsonValue = input;
+    Type value{};
+    parseValueHelper(jsonValue, "field key", value);
+}
+
+// One entry per destination shape exercised in tests/custom_test.cpp.
+template <typename... Types>
+void unpackAll(const nlohmann::json& input) {
+    (unpackOne<Types>(input), ...);
+}
+
+void unpackEveryShape(const nlohmann::json& input) {
+    unpackAll<
+        uint8_t, uint16_t, int16_t, uint32_t, int32_t, uint64_t, int64_t,
+        bool, double, std::string, nlohmann::json, nlohmann::json::object_t,
+        std::variant<std::string, std::nullptr_t>,
+        std::variant<uint8_t, std::nullptr_t>,
+        std::variant<int16_t, std::nullptr_t>,
+        std::variant<uint16_t, std::nullptr_t>,
+        std::variant<int32_t, std::nullptr_t>,
+        std::variant<uint32_t, std::nullptr_t>,
+        std::variant<int64_t, std::nullptr_t>,
+        std::variant<uint64_t, std::nullptr_t>,
+        std::variant<double, std::nullptr_t>,
+        std::variant<bool, std::nullptr_t>,
+        std::vector<uint8_t>, std::vector<uint16_t>, std::vector<int16_t>,
+        std::vector<uint32_t>, std::vector<int32_t>, std::vector<uint64_t>,
+        std::vector<int64_t>, std::vector<double>, std::vector<std::string>,
+        std::vector<nlohmann::json::object_t>, std::vector<nlohmann::json>,
+        std::optional<uint8_t>, std::optional<double>,
+        std::optional<std::string>, std::optional<nlohmann::json::object_t>,
+        std::optional<nlohmann::json>,
+        std::optional<std::vector<uint8_t>>,
+        std::optional<std::vector<int64_t>>,
+        std::optional<std::vector<double>>,
+        std::optional<std::vector<std::string>>,
+        std::optional<std::vector<nlohmann::json::object_t>>,
+        std::optional<std::vector<nlohmann::json>>,
+        std::optional<std::variant<std::string, std::nullptr_t>>,
+        std::optional<std::variant<uint8_t, std::nullptr_t>>,
+        std::optional<std::variant<int16_t, std::nullptr_t>>,
+        std::optional<std::variant<uint16_t, std::nullptr_t>>,
+        std::optional<std::variant<int32_t, std::nullptr_t>>,
+        std::optional<std::variant<uint32_t, std::nullptr_t>>,
+        std::optional<std::variant<int64_t, std::nullptr_t>>,
+        std::optional<std::variant<uint64_t, std::nullptr_t>>,
+        std::optional<std::variant<double, std::nullptr_t>>,
+        std::optional<std::variant<bool, std::nullptr_t>>,
+        std::optional<std::vector<
+            std::variant<nlohmann::json::object_t, std::nullptr_t>>>,
+        std::optional<std::vector<std::variant<
+            std::string, nlohmann::json::object_t, std::nullptr_t>>>,
+        std::optional<ComplexVariant>>(input);
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, std::size_t size) {
+    nlohmann::json input = nlohmann::json::parse(data, data + size, nullptr,
+                                                 false);
+    if (input.is_discarded()) {
+        return 0;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    unpackEveryShape(input);
+    auto elapsed = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start);
+
+    if (size < minTimedInputSize) {
+        return 0;
+    }
+
+    static double worstNsPerByte = 0.0;
+    double nsPerByte = elapsed.count() / static_cast<double>(size);
+    if (nsPerByte > worstNsPerByte) {
+        worstNsPerByte = nsPerByte;
+        std::fprintf(stderr, "new worst decode time: %.1f ns/byte (%zu bytes)\n",
+                     nsPerByte, size);
+    }
+    if (nsPerByte > maxNsPerByte()) {
+        // Abort so libFuzzer saves the input as a crash artifact.
+        std::fprintf(stderr, "decode time %.1f ns/byte exceeds limit %.1f\n",
+                     nsPerByte, maxNsPerByte());
+        std::abort();
+    }
+    return 0;
+}
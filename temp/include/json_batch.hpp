@@ -0,0 +1,86 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "json_utils.hpp"
+
+namespace redfish::json_util {
+
+using details::UnpackErrorCode;
+
+struct BatchError {
+    std::size_t index;
+    UnpackErrorCode code;
+};
+
+// Reusable state for parseBatch(). Keep one per worker and pass it to every
+// batch so the error list keeps its capacity between calls.
+class BatchContext {
+  public:
+    explicit BatchContext(std::size_t expectedErrors = 0) {
+        errors.reserve(expectedErrors);
+    }
+
+    const std::vector<BatchError>& getErrors() const {
+        return errors;
+    }
+
+    bool hasErrors() const {
+        return !errors.empty();
+    }
+
+    void clear() {
+        errors.clear();
+    }
+
+  private:
+    template <typename Type>
+    friend UnpackErrorCode parseBatch(BatchContext& context,
+                                      std::span<nlohmann::json> documents,
+                                      std::string_view key,
+                                      std::vector<Type>& values);
+
+    std::vector<BatchError> errors;
+};
+
+// Unpacks documents[i] into values[i] for every document. values is resized
+// to documents.size(), so passing the same vector again reuses its storage.
+// Every failing index is recorded in the context and its slot is reset to
+// Type{}, so no value from an earlier batch survives. The first failing code
+// is returned, or success when all documents unpacked.
+template <typename Type>
+UnpackErrorCode parseBatch(BatchContext& context,
+                           std::span<nlohmann::json> documents,
+                           std::string_view key, std::vector<Type>& values) {
+    context.clear();
+    values.resize(documents.size());
+
+    UnpackErrorCode result = UnpackErrorCode::success;
+    for (std::size_t i = 0; i < documents.size(); ++i) {
+        UnpackErrorCode code = UnpackErrorCode::success;
+        if constexpr (std::is_same_v<Type, bool>) {
+            // std::vector<bool> elements cannot bind to bool&.
+            bool value = false;
+            code = details::parseValueHelper(documents[i], key, value);
+            values[i] = value;
+        } else {
+            code = details::parseValueHelper(documents[i], key, values[i]);
+        }
+        if (code != UnpackErrorCode::success) {
+            values[i] = Type{};
+            if (result == UnpackErrorCode::success) {
+                result = code;
+            }
+            context.errors.push_back({i, code});
+        }
+    }
+    return result;
+}
+
+} // namespace redfish::json_util
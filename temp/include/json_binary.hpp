@@ -0,0 +1,318 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "json_utils.hpp"
+
+namespace redfish::json_util {
+
+using details::UnpackErrorCode;
+
+enum class BinaryEncoding { base64, base64Url, hex };
+
+// Bytes carried in a JSON string. base64 follows RFC 4648 section 4 and
+// requires padding; base64Url follows section 5 with optional padding; hex
+// accepts either letter case. Non-zero unused bits in the last base64 group
+// are rejected, so every byte sequence has exactly one accepted encoding.
+template <BinaryEncoding encoding>
+struct EncodedBytes {
+    std::vector<std::byte> bytes;
+
+    bool operator==(const EncodedBytes&) const = default;
+};
+
+using Base64Bytes = EncodedBytes<BinaryEncoding::base64>;
+using Base64UrlBytes = EncodedBytes<BinaryEncoding::base64Url>;
+using HexBytes = EncodedBytes<BinaryEncoding::hex>;
+
+namespace details {
+
+constexpr uint8_t invalidDigit = 0xff;
+
+constexpr std::array<uint8_t, 256> makeBase64Table(char plus, char slash) {
+    std::array<uint8_t, 256> table{};
+    table.fill(invalidDigit);
+    for (uint8_t i = 0; i < 26; ++i) {
+        table[static_cast<uint8_t>('A' + i)] = i;
+        table[static_cast<uint8_t>('a' + i)] = static_cast<uint8_t>(26 + i);
+    }
+    for (uint8_t i = 0; i < 10; ++i) {
+        table[static_cast<uint8_t>('0' + i)] = static_cast<uint8_t>(52 + i);
+    }
+    table[static_cast<uint8_t>(plus)] = 62;
+    table[static_cast<uint8_t>(slash)] = 63;
+    return table;
+}
+
+constexpr std::array<uint8_t, 256> makeHexTable() {
+    std::array<uint8_t, 256> table{};
+    table.fill(invalidDigit);
+    for (uint8_t i = 0; i < 10; ++i) {
+        table[static_cast<uint8_t>('0' + i)] = i;
+    }
+    for (uint8_t i = 0; i < 6; ++i) {
+        table[static_cast<uint8_t>('a' + i)] = static_cast<uint8_t>(10 + i);
+        table[static_cast<uint8_t>('A' + i)] = static_cast<uint8_t>(10 + i);
+    }
+    return table;
+}
+
+inline constexpr std::array<uint8_t, 256> base64Table = makeBase64Table('+', '/');
+inline constexpr std::array<uint8_t, 256> base64UrlTable =
+    makeBase64Table('-', '_');
+inline constexpr std::array<uint8_t, 256> hexTable = makeHexTable();
+
+#if defined(__AVX2__)
+// Decodes 32 base64 characters into 24 bytes, after Klomp and Mula. Each
+// character is classified by its high and low nibble through two shuffles;
+// a non-zero AND of the classes marks an invalid character. Returns false,
+// writing nothing, when any of the 32 characters is invalid.
+inline bool decodeBase64Block(const char* in, uint8_t* out, bool url) {
+    __m256i str = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+    const __m256i lutLo =
+        url ? _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                               0x11, 0x11, 0x13, 0x3b, 0x3b, 0x3a, 0x3b, 0x33,
+                               0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                               0x11, 0x11, 0x13, 0x3b, 0x3b, 0x3a, 0x3b, 0x33)
+            : _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                               0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a,
+                               0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                               0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+    const __m256i lutHi =
+        url ? _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20,
+                               0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                               0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20,
+                               0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10)
+            : _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                               0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                               0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                               0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    // Offset added to each character, indexed by high nibble. '/' (standard)
+    // and '_' (URL-safe) share a high nibble with other characters and are
+    // patched separately.
+    const __m256i lutRoll =
+        url ? _mm256_setr_epi8(0, 0, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0,
+                               0, 0, 0, 0, 0, 17, 4, -65, -65, -71, -71, 0, 0,
+                               0, 0, 0, 0, 0, 0)
+            : _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0,
+                               0, 0, 0, 0, 16, 19, 4, -65, -65, -71, -71, 0, 0,
+                               0, 0, 0, 0, 0, 0);
+    const __m256i mask2F = _mm256_set1_epi8(0x2f);
+
+    __m256i hiNibbles = _mm256_and_si256(_mm256_srli_epi32(str, 4), mask2F);
+    __m256i loNibbles = _mm256_and_si256(str, mask2F);
+    __m256i hi = _mm256_shuffle_epi8(lutHi, hiNibbles);
+    __m256i lo = _mm256_shuffle_epi8(lutLo, loNibbles);
+    if (!_mm256_testz_si256(lo, hi)) {
+        return false;
+    }
+    __m256i roll;
+    if (url) {
+        __m256i isUnderscore = _mm256_cmpeq_epi8(str, _mm256_set1_epi8('_'));
+        roll = _mm256_blendv_epi8(_mm256_shuffle_epi8(lutRoll, hiNibbles),
+                                  _mm256_set1_epi8(-32), isUnderscore);
+    } else {
+        __m256i isSlash = _mm256_cmpeq_epi8(str, mask2F);
+        roll = _mm256_shuffle_epi8(lutRoll, _mm256_add_epi8(isSlash, hiNibbles));
+    }
+    str = _mm256_add_epi8(str, roll);
+
+    // Pack four 6-bit values per 32-bit lane into three bytes.
+    str = _mm256_maddubs_epi16(str, _mm256_set1_epi32(0x01400140));
+    str = _mm256_madd_epi16(str, _mm256_set1_epi32(0x00011000));
+    str = _mm256_shuffle_epi8(
+        str, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1,
+                              -1, -1, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+                              -1, -1, -1, -1));
+    str = _mm256_permutevar8x32_epi32(str,
+                                      _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+    alignas(32) uint8_t block[32];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(block), str);
+    std::memcpy(out, block, 24);
+    return true;
+}
+#endif
+
+#if defined(__SSE2__)
+// Converts 16 hex characters to their nibble values. Returns false when any
+// of them is not a hex digit.
+inline bool hexNibbles(__m128i chars, __m128i& nibbles) {
+    __m128i digits = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    __m128i isDigit =
+        _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+    __m128i letters = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)),
+                                   _mm_set1_epi8('a'));
+    __m128i isLetter =
+        _mm_cmpeq_epi8(_mm_min_epu8(letters, _mm_set1_epi8(5)), letters);
+    if (_mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) != 0xffff) {
+        return false;
+    }
+    nibbles = _mm_or_si128(
+        _mm_and_si128(isDigit, digits),
+        _mm_and_si128(isLetter, _mm_add_epi8(letters, _mm_set1_epi8(10))));
+    return true;
+}
+
+// Combines pairs of nibbles (high first) into the low byte of each 16-bit
+// lane.
+inline __m128i joinNibbles(__m128i nibbles) {
+    return _mm_or_si128(
+        _mm_and_si128(_mm_slli_epi16(nibbles, 4), _mm_set1_epi16(0x00f0)),
+        _mm_srli_epi16(nibbles, 8));
+}
+
+// Decodes 32 hex characters into 16 bytes. Returns false, writing nothing,
+// when any character is not a hex digit.
+inline bool decodeHexBlock(const char* in, uint8_t* out) {
+    __m128i first;
+    __m128i second;
+    if (!hexNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)),
+                    first) ||
+        !hexNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 16)),
+                    second)) {
+        return false;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                     _mm_packus_epi16(joinNibbles(first), joinNibbles(second)));
+    return true;
+}
+#endif
+
+// Decodes four base64 characters into three bytes with the scalar table.
+inline bool decodeBase64Quad(const unsigned char* in, uint8_t* out,
+                             const std::array<uint8_t, 256>& table) {
+    uint32_t a = table[in[0]];
+    uint32_t b = table[in[1]];
+    uint32_t c = table[in[2]];
+    uint32_t d = table[in[3]];
+    // Invalid characters map to 0xff, so one test on the OR covers all four.
+    if (((a | b | c | d) & 0x80) != 0) {
+        return false;
+    }
+    uint32_t bits = a << 18 | b << 12 | c << 6 | d;
+    out[0] = static_cast<uint8_t>(bits >> 16);
+    out[1] = static_cast<uint8_t>(bits >> 8);
+    out[2] = static_cast<uint8_t>(bits);
+    return true;
+}
+
+// Decodes 2 * size hex characters into size bytes.
+inline bool decodeHexRun(const char* in, uint8_t* out, std::size_t size) {
+    std::size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 16 <= size; i += 16) {
+        if (!decodeHexBlock(in + i * 2, out + i)) {
+            return false;
+        }
+    }
+#endif
+    for (; i < size; ++i) {
+        uint8_t high = hexTable[static_cast<uint8_t>(in[i * 2])];
+        uint8_t low = hexTable[static_cast<uint8_t>(in[i * 2 + 1])];
+        if (((high | low) & 0x80) != 0) {
+            return false;
+        }
+        out[i] = static_cast<uint8_t>(high << 4 | low);
+    }
+    return true;
+}
+
+} // namespace details
+
+// Decodes base64 text into bytes, resizing bytes once to the exact decoded
+// length. Returns false on any invalid character, length or padding.
+inline bool decodeBase64(std::string_view text, bool url,
+                         std::vector<std::byte>& bytes) {
+    const std::array<uint8_t, 256>& table =
+        url ? details::base64UrlTable : details::base64Table;
+    std::size_t padding = 0;
+    if (text.size() % 4 == 0 && text.ends_with("==")) {
+        padding = 2;
+    } else if (text.size() % 4 == 0 && text.ends_with("=")) {
+        padding = 1;
+    }
+    std::size_t digits = text.size() - padding;
+    // The last group holds 2 or 3 digits when it decodes 1 or 2 bytes.
+    std::size_t tailDigits = digits % 4;
+    if (tailDigits == 1 || (!url && text.size() % 4 != 0)) {
+        return false;
+    }
+    std::size_t size = digits / 4 * 3 + (tailDigits == 0 ? 0 : tailDigits - 1);
+    bytes.resize(size);
+    auto* out = reinterpret_cast<uint8_t*>(bytes.data());
+    const auto* in = reinterpret_cast<const unsigned char*>(text.data());
+    std::size_t fullQuads = digits / 4;
+
+    std::size_t quad = 0;
+#if defined(__AVX2__)
+    for (; quad + 8 <= fullQuads; quad += 8) {
+        if (!details::decodeBase64Block(text.data() + quad * 4, out + quad * 3,
+                                        url)) {
+            return false;
+        }
+    }
+#endif
+    for (; quad < fullQuads; ++quad) {
+        if (!details::decodeBase64Quad(in + quad * 4, out + quad * 3, table)) {
+            return false;
+        }
+    }
+    if (tailDigits != 0) {
+        unsigned char last[4] = {'A', 'A', 'A', 'A'};
+        std::memcpy(last, in + fullQuads * 4, tailDigits);
+        uint8_t decoded[3];
+        if (!details::decodeBase64Quad(last, decoded, table)) {
+            return false;
+        }
+        // Bits beyond the last byte must be zero.
+        if (decoded[tailDigits - 1] != 0) {
+            return false;
+        }
+        std::memcpy(out + fullQuads * 3, decoded, tailDigits - 1);
+    }
+    return true;
+}
+
+// Decodes hex text into bytes, resizing bytes once to the exact decoded
+// length. Returns false on odd length or any non-hex character.
+inline bool decodeHex(std::string_view text, std::vector<std::byte>& bytes) {
+    if (text.size() % 2 != 0) {
+        return false;
+    }
+    bytes.resize(text.size() / 2);
+    return details::decodeHexRun(text.data(),
+                                 reinterpret_cast<uint8_t*>(bytes.data()),
+                                 bytes.size());
+}
+
+template <BinaryEncoding encoding>
+UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                 std::string_view /*key*/,
+                                 EncodedBytes<encoding>& value) {
+    const std::string* text = jsonValue.get_ptr<const std::string*>();
+    if (text == nullptr) {
+        return UnpackErrorCode::invalidType;
+    }
+    bool decoded = encoding == BinaryEncoding::hex
+                       ? decodeHex(*text, value.bytes)
+                       : decodeBase64(*text, encoding == BinaryEncoding::base64Url,
+                                      value.bytes);
+    return decoded ? UnpackErrorCode::success : UnpackErrorCode::invalidType;
+}
+
+} // namespace redfish::json_util
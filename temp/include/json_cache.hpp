@@ -0,0 +1,118 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "json_utils.hpp"
+
+namespace redfish::json_util {
+
+using details::UnpackErrorCode;
+
+struct UnpackCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+};
+
+// Thread-safe LRU cache of decoded values keyed by the raw request body.
+// One cache holds one destination type, so the type is part of the key by
+// construction. Only successful unpacks are cached; a capacity of 0 turns
+// the cache into a pass-through.
+template <typename Type>
+class UnpackCache {
+  public:
+    explicit UnpackCache(std::size_t capacity) : capacity(capacity) {
+        index.reserve(capacity);
+    }
+
+    UnpackCache(const UnpackCache&) = delete;
+    UnpackCache& operator=(const UnpackCache&) = delete;
+
+    // On a hit, value is set to the shared decoded value. On a miss the body
+    // goes through nlohmann::json::parse() and parseValueHelper() exactly as
+    // it would without the cache, so malformed JSON still throws.
+    UnpackErrorCode get(std::string_view body, std::string_view key,
+                        std::shared_ptr<const Type>& value) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = index.find(body);
+            if (it != index.end()) {
+                entries.splice(entries.begin(), entries, it->second);
+                ++stats.hits;
+                value = it->second->value;
+                return UnpackErrorCode::success;
+            }
+            ++stats.misses;
+        }
+
+        nlohmann::json jsonValue = nlohmann::json::parse(body);
+        auto decoded = std::make_shared<Type>();
+        UnpackErrorCode code =
+            details::parseValueHelper(jsonValue, key, *decoded);
+        if (code != UnpackErrorCode::success) {
+            return code;
+        }
+        value = std::move(decoded);
+        insert(body, value);
+        return UnpackErrorCode::success;
+    }
+
+    UnpackCacheStats getStats() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return stats;
+    }
+
+    std::size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return entries.size();
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        index.clear();
+        entries.clear();
+        stats = {};
+    }
+
+  private:
+    struct Entry {
+        std::string body;
+        std::shared_ptr<const Type> value;
+    };
+
+    void insert(std::string_view body,
+                const std::shared_ptr<const Type>& value) {
+        if (capacity == 0) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        // Another thread may have decoded the same body meanwhile.
+        if (index.contains(body)) {
+            return;
+        }
+        if (entries.size() >= capacity) {
+            index.erase(entries.back().body);
+            entries.pop_back();
+        }
+        entries.push_front({std::string(body), value});
+        // The key views the string owned by the list node, which never moves.
+        index.emplace(entries.front().body, entries.begin());
+    }
+
+    const std::size_t capacity;
+    mutable std::mutex mutex;
+    std::list<Entry> entries;
+    std::unordered_map<std::string_view, typename std::list<Entry>::iterator>
+        index;
+    UnpackCacheStats stats;
+};
+
+} // namespace redfish::json_util
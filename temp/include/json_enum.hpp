@@ -0,0 +1,305 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "json_utils.hpp"
+
+namespace redfish::json_util {
+
+using details::UnpackErrorCode;
+
+template <typename Enum>
+struct EnumString {
+    std::string_view name;
+    Enum value;
+};
+
+namespace details {
+
+constexpr uint64_t hashEnumName(std::string_view name) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (char c : name) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+constexpr uint64_t mixEnumHash(uint64_t hash, uint32_t displacement) {
+    hash ^= displacement * 0x9e3779b97f4a7c15ULL;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+} // namespace details
+
+// Perfect hash from enumerator names to values, built during constant
+// evaluation with hash-and-displace: names are grouped into buckets by their
+// hash and every bucket gets a displacement that moves all of its names into
+// free slots. A lookup hashes the name once, reads one displacement and
+// compares against the single candidate it lands on. Duplicate names make the
+// construction fail to compile. Tables of up to 4096 names build within GCC's
+// default -fconstexpr-ops-limit.
+template <typename Enum, std::size_t N>
+class EnumTable {
+    static_assert(N > 0 && N <= 4096, "enum table size out of range");
+
+  public:
+    constexpr explicit EnumTable(const std::array<EnumString<Enum>, N>& names) :
+        strings(names) {
+        std::array<uint64_t, N> hashes{};
+        std::array<std::size_t, bucketCount + 1> bucketStart{};
+        for (std::size_t i = 0; i < N; ++i) {
+            hashes[i] = details::hashEnumName(names[i].name);
+            ++bucketStart[(hashes[i] & (bucketCount - 1)) + 1];
+        }
+        for (std::size_t bucket = 0; bucket < bucketCount; ++bucket) {
+            bucketStart[bucket + 1] += bucketStart[bucket];
+        }
+        // Entry indexes grouped by bucket; equal names always share one.
+        std::array<uint16_t, N> members{};
+        std::array<std::size_t, bucketCount> filled{};
+        for (std::size_t i = 0; i < N; ++i) {
+            std::size_t bucket = hashes[i] & (bucketCount - 1);
+            members[bucketStart[bucket] + filled[bucket]++] =
+                static_cast<uint16_t>(i);
+        }
+
+        std::array<std::size_t, bucketCount> order{};
+        for (std::size_t bucket = 0; bucket < bucketCount; ++bucket) {
+            order[bucket] = bucket;
+        }
+        // Large buckets are placed first, while most slots are still free.
+        std::sort(order.begin(), order.end(),
+                  [&bucketStart](std::size_t a, std::size_t b) {
+                      return bucketStart[a + 1] - bucketStart[a] >
+                             bucketStart[b + 1] - bucketStart[b];
+                  });
+        slots.fill(emptySlot);
+        for (std::size_t bucket : order) {
+            const uint16_t* first = members.data() + bucketStart[bucket];
+            std::size_t count = bucketStart[bucket + 1] - bucketStart[bucket];
+            if (count == 0) {
+                break;
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                for (std::size_t j = 0; j < i; ++j) {
+                    if (names[first[i]].name == names[first[j]].name) {
+                        throw "duplicate name in enum table";
+                    }
+                }
+            }
+            placeBucket(bucket, first, count, hashes);
+        }
+    }
+
+    constexpr std::optional<Enum> find(std::string_view name) const {
+        uint64_t hash = details::hashEnumName(name);
+        uint16_t index =
+            slots[slotOf(hash, displacements[hash & (bucketCount - 1)])];
+        if (index == emptySlot || strings[index].name != name) {
+            return std::nullopt;
+        }
+        return strings[index].value;
+    }
+
+    constexpr const std::array<EnumString<Enum>, N>& entries() const {
+        return strings;
+    }
+
+  private:
+    static constexpr std::size_t bucketCount = std::bit_ceil(N);
+    static constexpr std::size_t slotCount = std::bit_ceil(2 * N);
+    static constexpr uint16_t emptySlot = 0xffff;
+    static constexpr uint32_t maxDisplacement = 1U << 20;
+
+    static constexpr std::size_t slotOf(uint64_t hash, uint32_t displacement) {
+        return details::mixEnumHash(hash, displacement) & (slotCount - 1);
+    }
+
+    // Claims slots for the bucket's entries one by one and releases them
+    // again as soon as one collides, so a failed displacement costs only the
+    // entries probed so far.
+    constexpr void placeBucket(std::size_t bucket, const uint16_t* members,
+                               std::size_t count,
+                               const std::array<uint64_t, N>& hashes) {
+        for (uint32_t displacement = 0; displacement < maxDisplacement;
+             ++displacement) {
+            std::size_t placed = 0;
+            for (; placed < count; ++placed) {
+                std::size_t slot =
+                    slotOf(hashes[members[placed]], displacement);
+                if (slots[slot] != emptySlot) {
+                    break;
+                }
+                slots[slot] = members[placed];
+            }
+            if (placed == count) {
+                displacements[bucket] = displacement;
+                return;
+            }
+            for (std::size_t i = 0; i < placed; ++i) {
+                slots[slotOf(hashes[members[i]], displacement)] = emptySlot;
+            }
+        }
+        throw "no perfect hash found for enum table";
+    }
+
+    std::array<EnumString<Enum>, N> strings;
+    std::array<uint32_t, bucketCount> displacements{};
+    std::array<uint16_t, slotCount> slots{};
+};
+
+template <typename Enum, std::size_t N>
+constexpr EnumTable<Enum, N> makeEnumTable(EnumString<Enum> (&&entries)[N]) {
+    return EnumTable<Enum, N>(std::to_array(std::move(entries)));
+}
+
+namespace details {
+
+// The table REDFISH_JSON_UNPACK_ENUM declares for Enum, built once during
+// constant evaluation.
+template <typename Enum>
+inline constexpr auto enumTable = unpackEnumTable(Enum{});
+
+// Whether every enumerator in Enum's table can select a bit of a uint64_t.
+template <typename Enum>
+constexpr bool enumFitsMask() {
+    using Position = std::make_unsigned_t<std::underlying_type_t<Enum>>;
+    for (const EnumString<Enum>& entry : enumTable<Enum>.entries()) {
+        if (static_cast<Position>(entry.value) >= 64) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Enum, std::size_t N>
+UnpackErrorCode parseEnum(const nlohmann::json& jsonValue,
+                          const EnumTable<Enum, N>& table, Enum& value) {
+    const std::string* name = jsonValue.get_ptr<const std::string*>();
+    if (name == nullptr) {
+        return UnpackErrorCode::invalidType;
+    }
+    std::optional<Enum> found = table.find(*name);
+    if (!found) {
+        return UnpackErrorCode::invalidType;
+    }
+    value = *found;
+    return UnpackErrorCode::success;
+}
+
+} // namespace details
+
+enum class DuplicateFlags { allow, reject };
+enum class UnknownFlags { reject, ignore };
+
+// Set of Enum values unpacked from an array of enumerator names. Each
+// enumerator selects bit static_cast<underlying>(value), so every enumerator
+// in the table must be numbered below 64; anything else fails to compile. The
+// policies decide whether a repeated name or a name missing from the table
+// fails the unpack with invalidType.
+template <typename Enum, DuplicateFlags duplicates = DuplicateFlags::allow,
+          UnknownFlags unknown = UnknownFlags::reject>
+class EnumFlags {
+    static_assert(details::enumFitsMask<Enum>(),
+                  "EnumFlags enumerators must be numbered from 0 to 63");
+
+  public:
+    using Mask = uint64_t;
+
+    constexpr EnumFlags() = default;
+
+    constexpr explicit EnumFlags(Mask bits) : bits(bits) {}
+
+    static constexpr Mask bit(Enum flag) {
+        return Mask{1} << static_cast<std::underlying_type_t<Enum>>(flag);
+    }
+
+    constexpr bool test(Enum flag) const {
+        return (bits & bit(flag)) != 0;
+    }
+
+    constexpr void set(Enum flag) {
+        bits |= bit(flag);
+    }
+
+    constexpr Mask mask() const {
+        return bits;
+    }
+
+    constexpr bool operator==(const EnumFlags&) const = default;
+
+  private:
+    Mask bits = 0;
+};
+
+template <typename Enum, DuplicateFlags duplicates, UnknownFlags unknown>
+UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                 std::string_view /*key*/,
+                                 EnumFlags<Enum, duplicates, unknown>& value) {
+    using Flags = EnumFlags<Enum, duplicates, unknown>;
+    const nlohmann::json::array_t* names =
+        jsonValue.get_ptr<const nlohmann::json::array_t*>();
+    if (names == nullptr) {
+        return UnpackErrorCode::invalidType;
+    }
+    const auto& table = details::enumTable<Enum>;
+    typename Flags::Mask bits = 0;
+    for (const nlohmann::json& element : *names) {
+        const std::string* name = element.get_ptr<const std::string*>();
+        if (name == nullptr) {
+            return UnpackErrorCode::invalidType;
+        }
+        std::optional<Enum> flag = table.find(*name);
+        if (!flag) {
+            if constexpr (unknown == UnknownFlags::ignore) {
+                continue;
+            } else {
+                return UnpackErrorCode::invalidType;
+            }
+        }
+        typename Flags::Mask flagBit = Flags::bit(*flag);
+        if constexpr (duplicates == DuplicateFlags::reject) {
+            if ((bits & flagBit) != 0) {
+                return UnpackErrorCode::invalidType;
+            }
+        }
+        bits |= flagBit;
+    }
+    value = Flags(bits);
+    return UnpackErrorCode::success;
+}
+
+} // namespace redfish::json_util
+
+// Makes EnumType a parseValueHelper destination that accepts exactly the
+// listed strings, and EnumFlags<EnumType> one that accepts arrays of them.
+// Use it in the namespace that declares EnumType, like
+// NLOHMANN_JSON_SERIALIZE_ENUM, so both are found through ADL:
+//
+//   REDFISH_JSON_UNPACK_ENUM(PowerState, {"On", PowerState::On},
+//                            {"Off", PowerState::Off})
+#define REDFISH_JSON_UNPACK_ENUM(EnumType, ...)                                \
+    constexpr auto unpackEnumTable(EnumType /*tag*/) {                         \
+        return redfish::json_util::makeEnumTable<EnumType>({__VA_ARGS__});     \
+    }                                                                          \
+    inline redfish::json_util::UnpackErrorCode parseValueHelper(               \
+        nlohmann::json& jsonValue, std::string_view /*key*/,                   \
+        EnumType& value) {                                                     \
+        return redfish::json_util::details::parseEnum(                         \
+            jsonValue, redfish::json_util::details::enumTable<EnumType>,       \
+            value);                                                            \
+    }
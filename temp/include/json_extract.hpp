@@ -0,0 +1,478 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "json_utils.hpp"
+
+namespace redfish::json_util {
+
+using details::UnpackErrorCode;
+
+// A JSON Pointer split into reference tokens once, so handlers can keep it in
+// a static and reuse it for every request.
+class JsonPath {
+  public:
+    explicit JsonPath(const nlohmann::json::json_pointer& pointer) :
+        text(pointer.to_string()) {
+        nlohmann::json::json_pointer rest = pointer;
+        while (!rest.empty()) {
+            tokens.push_back(rest.back());
+            rest.pop_back();
+        }
+        std::reverse(tokens.begin(), tokens.end());
+        indices.reserve(tokens.size());
+        for (const std::string& token : tokens) {
+            indices.push_back(toArrayIndex(token));
+        }
+    }
+
+    explicit JsonPath(std::string_view pointer) :
+        JsonPath(nlohmann::json::json_pointer(std::string(pointer))) {}
+
+    const std::string& toString() const {
+        return text;
+    }
+
+    std::size_t size() const {
+        return tokens.size();
+    }
+
+    const std::string& token(std::size_t i) const {
+        return tokens[i];
+    }
+
+    // Array index named by token i, or nullopt when the token cannot address
+    // an array element ("-", leading zeros, non-digits).
+    std::optional<std::size_t> index(std::size_t i) const {
+        return indices[i];
+    }
+
+  private:
+    static std::optional<std::size_t> toArrayIndex(const std::string& token) {
+        if (token.empty() || (token.size() > 1 && token[0] == '0')) {
+            return std::nullopt;
+        }
+        std::size_t result = 0;
+        for (char c : token) {
+            if (c < '0' || c > '9') {
+                return std::nullopt;
+            }
+            result = result * 10 + static_cast<std::size_t>(c - '0');
+        }
+        return result;
+    }
+
+    std::string text;
+    std::vector<std::string> tokens;
+    std::vector<std::optional<std::size_t>> indices;
+};
+
+namespace details {
+
+template <typename Type>
+struct IsOptionalDestination : std::false_type {};
+
+template <typename Type>
+struct IsOptionalDestination<std::optional<Type>> : std::true_type {};
+
+// Looks up path in an already parsed document without copying anything.
+inline nlohmann::json* findPath(nlohmann::json& root, const JsonPath& path) {
+    nlohmann::json* node = &root;
+    for (std::size_t i = 0; i < path.size(); ++i) {
+        if (nlohmann::json::object_t* object =
+                node->get_ptr<nlohmann::json::object_t*>()) {
+            auto it = object->find(path.token(i));
+            if (it == object->end()) {
+                return nullptr;
+            }
+            node = &it->second;
+        } else if (nlohmann::json::array_t* array =
+                       node->get_ptr<nlohmann::json::array_t*>()) {
+            std::optional<std::size_t> index = path.index(i);
+            if (!index || *index >= array->size()) {
+                return nullptr;
+            }
+            node = &(*array)[*index];
+        } else {
+            return nullptr;
+        }
+    }
+    return node;
+}
+
+// Prefix tree of the paths registered for one extraction. Node 0 is the
+// document root. A token that is a valid array index is reachable both as an
+// object member and as an array element.
+class PathTrie {
+  public:
+    struct Node {
+        std::map<std::string, std::size_t, std::less<>> members;
+        std::map<std::size_t, std::size_t> elements;
+        bool isTarget = false;
+    };
+
+    PathTrie() : nodes(1) {}
+
+    std::size_t insert(const JsonPath& path) {
+        std::size_t node = 0;
+        for (std::size_t i = 0; i < path.size(); ++i) {
+            auto it = nodes[node].members.find(path.token(i));
+            std::size_t child = 0;
+            if (it != nodes[node].members.end()) {
+                child = it->second;
+            } else {
+                child = nodes.size();
+                nodes.emplace_back();
+                nodes[node].members.emplace(path.token(i), child);
+                if (std::optional<std::size_t> index = path.index(i)) {
+                    nodes[node].elements.emplace(*index, child);
+                }
+            }
+            node = child;
+        }
+        nodes[node].isTarget = true;
+        return node;
+    }
+
+    const Node& operator[](std::size_t node) const {
+        return nodes[node];
+    }
+
+    std::size_t size() const {
+        return nodes.size();
+    }
+
+  private:
+    std::vector<Node> nodes;
+};
+
+// Points located[node] at the value under root for node and every node below
+// it, leaving nullptr where the document has no such value.
+inline void locatePaths(const PathTrie& trie, std::size_t node,
+                        nlohmann::json* jsonValue,
+                        std::vector<nlohmann::json*>& located) {
+    located[node] = jsonValue;
+    if (nlohmann::json::object_t* object =
+            jsonValue->get_ptr<nlohmann::json::object_t*>()) {
+        for (const auto& [key, child] : trie[node].members) {
+            auto it = object->find(key);
+            if (it != object->end()) {
+                locatePaths(trie, child, &it->second, located);
+            }
+        }
+    } else if (nlohmann::json::array_t* array =
+                   jsonValue->get_ptr<nlohmann::json::array_t*>()) {
+        for (const auto& [index, child] : trie[node].elements) {
+            if (index < array->size()) {
+                locatePaths(trie, child, &(*array)[index], located);
+            }
+        }
+    }
+}
+
+// SAX handler that follows every path in a trie through the input in one
+// pass and builds a DOM only for the values those paths point to. Everything
+// else is tokenized and dropped. Duplicate keys resolve to the last
+// occurrence, as nlohmann::json::parse() does, so the whole input is scanned.
+class PathScanner {
+  public:
+    using number_integer_t = nlohmann::json::number_integer_t;
+    using number_unsigned_t = nlohmann::json::number_unsigned_t;
+    using number_float_t = nlohmann::json::number_float_t;
+    using string_t = nlohmann::json::string_t;
+    using binary_t = nlohmann::json::binary_t;
+
+    explicit PathScanner(const PathTrie& trie) :
+        trie(trie), captured(trie.size()), found(trie.size(), false) {}
+
+    // Fills located with the scanned value of every trie node, or nullptr
+    // where the input had none. Paths below a target are looked up in the
+    // target's captured value.
+    void locate(std::vector<nlohmann::json*>& located) {
+        located.assign(trie.size(), nullptr);
+        for (std::size_t node = 0; node < trie.size(); ++node) {
+            if (found[node]) {
+                locatePaths(trie, node, &captured[node], located);
+            }
+        }
+    }
+
+    bool null() {
+        return handleValue(nullptr);
+    }
+
+    bool boolean(bool val) {
+        return handleValue(val);
+    }
+
+    bool number_integer(number_integer_t val) {
+        return handleValue(val);
+    }
+
+    bool number_unsigned(number_unsigned_t val) {
+        return handleValue(val);
+    }
+
+    bool number_float(number_float_t val, const string_t& /*unused*/) {
+        return handleValue(val);
+    }
+
+    bool string(string_t& val) {
+        return handleValue(std::move(val));
+    }
+
+    bool binary(binary_t& val) {
+        return handleValue(std::move(val));
+    }
+
+    bool start_object(std::size_t /*unused*/) {
+        return startContainer(nlohmann::json::value_t::object, false);
+    }
+
+    bool start_array(std::size_t /*unused*/) {
+        return startContainer(nlohmann::json::value_t::array, true);
+    }
+
+    bool key(string_t& val) {
+        if (!captureStack.empty()) {
+            pendingKey = std::move(val);
+        } else if (skipDepth == 0 && !frames.empty()) {
+            Frame& frame = frames.back();
+            const auto& members = trie[frame.node].members;
+            auto it = members.find(val);
+            frame.selected =
+                it != members.end() ? std::optional(it->second) : std::nullopt;
+        }
+        return true;
+    }
+
+    bool end_object() {
+        return endContainer();
+    }
+
+    bool end_array() {
+        return endContainer();
+    }
+
+    template <class Exception>
+    bool parse_error(std::size_t /*unused*/, const std::string& /*unused*/,
+                     const Exception& ex) {
+        throw ex;
+    }
+
+  private:
+    enum class Action { skip, descend, capture };
+
+    struct Frame {
+        std::size_t node;
+        bool isArray;
+        std::size_t nextIndex;
+        std::optional<std::size_t> selected;
+    };
+
+    // Decides what to do with a value that starts at the current position and
+    // stores the trie node it belongs to in node.
+    Action select(bool isContainer, std::size_t& node) {
+        if (skipDepth > 0) {
+            return Action::skip;
+        }
+        if (frames.empty()) {
+            node = 0;
+        } else {
+            Frame& frame = frames.back();
+            std::optional<std::size_t> child = frame.selected;
+            if (frame.isArray) {
+                const auto& elements = trie[frame.node].elements;
+                auto it = elements.find(frame.nextIndex++);
+                child = it != elements.end() ? std::optional(it->second)
+                                             : std::nullopt;
+            }
+            if (!child) {
+                return Action::skip;
+            }
+            node = *child;
+        }
+        // A repeated key replaces everything found under its earlier value.
+        forget(node);
+        if (trie[node].isTarget) {
+            return Action::capture;
+        }
+        return isContainer ? Action::descend : Action::skip;
+    }
+
+    void forget(std::size_t node) {
+        found[node] = false;
+        for (const auto& member : trie[node].members) {
+            forget(member.second);
+        }
+    }
+
+    nlohmann::json* insertCaptured(nlohmann::json&& val) {
+        nlohmann::json& parent = *captureStack.back();
+        if (parent.is_array()) {
+            parent.push_back(std::move(val));
+            return &parent.back();
+        }
+        nlohmann::json& slot = parent[pendingKey];
+        slot = std::move(val);
+        return &slot;
+    }
+
+    template <typename Value>
+    bool handleValue(Value&& val) {
+        std::size_t node = 0;
+        if (!captureStack.empty()) {
+            insertCaptured(nlohmann::json(std::forward<Value>(val)));
+        } else if (select(false, node) == Action::capture) {
+            captured[node] = nlohmann::json(std::forward<Value>(val));
+            found[node] = true;
+        }
+        return true;
+    }
+
+    bool startContainer(nlohmann::json::value_t type, bool isArray) {
+        if (!captureStack.empty()) {
+            captureStack.push_back(insertCaptured(nlohmann::json(type)));
+            return true;
+        }
+        std::size_t node = 0;
+        switch (select(true, node)) {
+            case Action::capture:
+                captured[node] = nlohmann::json(type);
+                found[node] = true;
+                captureStack.push_back(&captured[node]);
+                break;
+            case Action::descend:
+                frames.push_back({node, isArray, 0, std::nullopt});
+                break;
+            case Action::skip:
+                ++skipDepth;
+                break;
+        }
+        return true;
+    }
+
+    bool endContainer() {
+        if (!captureStack.empty()) {
+            captureStack.pop_back();
+        } else if (skipDepth > 0) {
+            --skipDepth;
+        } else {
+            frames.pop_back();
+        }
+        return true;
+    }
+
+    const PathTrie& trie;
+    std::vector<Frame> frames;
+    std::size_t skipDepth = 0;
+    std::vector<nlohmann::json*> captureStack;
+    std::string pendingKey;
+    std::vector<nlohmann::json> captured;
+    std::vector<bool> found;
+};
+
+template <typename Type>
+UnpackErrorCode unpackFound(nlohmann::json* jsonValue, const JsonPath& path,
+                            Type& value) {
+    if (jsonValue == nullptr) {
+        if constexpr (IsOptionalDestination<Type>::value) {
+            value.reset();
+            return UnpackErrorCode::success;
+        } else {
+            return UnpackErrorCode::invalidType;
+        }
+    }
+    return parseValueHelper(*jsonValue, path.toString(), value);
+}
+
+} // namespace details
+
+// Collects (path, destination) pairs and unpacks all of them from one pass
+// over the input. Destinations are unpacked in registration order and the
+// first failure is returned; a missing value is handled as in extractValue().
+class JsonExtractor {
+  public:
+    template <typename Type>
+    void add(const JsonPath& path, Type& value) {
+        targets.push_back({path, trie.insert(path), &value, &unpackTarget<Type>});
+    }
+
+    // Scans the raw body once. Malformed input throws
+    // nlohmann::json::parse_error, as nlohmann::json::parse() would.
+    UnpackErrorCode extract(std::string_view body) {
+        details::PathScanner scanner(trie);
+        nlohmann::json::sax_parse(body, &scanner);
+        std::vector<nlohmann::json*> located;
+        scanner.locate(located);
+        return unpackAll(located);
+    }
+
+    // Walks an already parsed document once, sharing common path prefixes.
+    UnpackErrorCode extract(nlohmann::json& root) {
+        std::vector<nlohmann::json*> located(trie.size(), nullptr);
+        details::locatePaths(trie, 0, &root, located);
+        return unpackAll(located);
+    }
+
+  private:
+    struct Target {
+        JsonPath path;
+        std::size_t node;
+        void* value;
+        UnpackErrorCode (*unpack)(nlohmann::json*, const JsonPath&, void*);
+    };
+
+    template <typename Type>
+    static UnpackErrorCode unpackTarget(nlohmann::json* jsonValue,
+                                        const JsonPath& path, void* value) {
+        return details::unpackFound(jsonValue, path, *static_cast<Type*>(value));
+    }
+
+    UnpackErrorCode unpackAll(const std::vector<nlohmann::json*>& located) {
+        for (const Target& target : targets) {
+            UnpackErrorCode code =
+                target.unpack(located[target.node], target.path, target.value);
+            if (code != UnpackErrorCode::success) {
+                return code;
+            }
+        }
+        return UnpackErrorCode::success;
+    }
+
+    details::PathTrie trie;
+    std::vector<Target> targets;
+};
+
+// Unpacks only the value at path. A missing value leaves an optional
+// destination empty and is reported as invalidType for any other destination,
+// the same code a null would produce.
+template <typename Type>
+UnpackErrorCode extractValue(nlohmann::json& root, const JsonPath& path,
+                             Type& value) {
+    return details::unpackFound(details::findPath(root, path), path, value);
+}
+
+// Same as above, but scans the raw body once and only materializes the
+// addressed value. Malformed input throws nlohmann::json::parse_error, as
+// nlohmann::json::parse() would.
+template <typename Type>
+UnpackErrorCode extractValue(std::string_view body, const JsonPath& path,
+                             Type& value) {
+    JsonExtractor extractor;
+    extractor.add(path, value);
+    return extractor.extract(body);
+}
+
+} // namespace redfish::json_util
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+#include "json_utils.hpp"
+
+namespace redfish::json_util {
+
+using details::UnpackErrorCode;
+
+// What a Floating destination does with a number its type cannot hold
+// exactly. reject fails with outOfRange on any rounding; round takes the
+// nearest value and fails with outOfRange only when that would overflow;
+// saturate rounds the same way but clamps out-of-range magnitudes to
+// lowest()/max().
+enum class PrecisionLoss { reject, round, saturate };
+
+// float or long double unpacked from any JSON number, integer or not.
+template <typename Type, PrecisionLoss policy = PrecisionLoss::round>
+struct Floating {
+    static_assert(std::is_floating_point_v<Type>,
+                  "Floating needs a floating-point type");
+
+    Type value{};
+
+    bool operator==(const Floating&) const = default;
+};
+
+namespace details {
+
+// Whether magnitude has no more significant bits than Type's mantissa.
+template <typename Type>
+constexpr bool fitsMantissa(uint64_t magnitude) {
+    constexpr int digits = std::numeric_limits<Type>::digits;
+    if constexpr (digits >= 64) {
+        return true;
+    } else {
+        if (magnitude == 0) {
+            return true;
+        }
+        return (magnitude >> std::countr_zero(magnitude)) >> digits == 0;
+    }
+}
+
+// Smallest magnitude that rounds to infinity in Type: max() plus half an ulp.
+// Everything below it rounds into range, so the shortest text of max(), such
+// as 3.4028235e38 for float, still converts.
+template <typename Type>
+double overflowThreshold() {
+    using Limits = std::numeric_limits<Type>;
+    return static_cast<double>(Limits::max()) +
+           std::ldexp(1.0, Limits::max_exponent - Limits::digits - 1);
+}
+
+template <typename Type, PrecisionLoss policy>
+UnpackErrorCode convertFloating(double number, Type& value) {
+    using Limits = std::numeric_limits<Type>;
+    // Types at least as wide as double hold every double.
+    if constexpr (Limits::max_exponent <
+                  std::numeric_limits<double>::max_exponent) {
+        static const double threshold = overflowThreshold<Type>();
+        if (std::fabs(number) >= threshold) {
+            if constexpr (policy == PrecisionLoss::saturate) {
+                value = number > 0 ? Limits::max() : Limits::lowest();
+                return UnpackErrorCode::success;
+            } else {
+                return UnpackErrorCode::outOfRange;
+            }
+        }
+    }
+    Type converted = static_cast<Type>(number);
+    if constexpr (policy == PrecisionLoss::reject) {
+        if (static_cast<double>(converted) != number) {
+            return UnpackErrorCode::outOfRange;
+        }
+    }
+    value = converted;
+    return UnpackErrorCode::success;
+}
+
+// Every 64-bit integer is within the range of float and wider types, so only
+// the reject policy can fail here.
+template <typename Type, PrecisionLoss policy, std::integral Integer>
+UnpackErrorCode convertFloating(Integer number, Type& value) {
+    if constexpr (policy == PrecisionLoss::reject) {
+        uint64_t magnitude = static_cast<uint64_t>(number);
+        if constexpr (std::is_signed_v<Integer>) {
+            if (number < 0) {
+                magnitude = uint64_t{0} - magnitude;
+            }
+        }
+        if (!fitsMantissa<Type>(magnitude)) {
+            return UnpackErrorCode::outOfRange;
+        }
+    }
+    value = static_cast<Type>(number);
+    return UnpackErrorCode::success;
+}
+
+} // namespace details
+
+template <typename Type, PrecisionLoss policy>
+UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                 std::string_view /*key*/,
+                                 Floating<Type, policy>& value) {
+    if (const double* number = jsonValue.get_ptr<const double*>()) {
+        return details::convertFloating<Type, policy>(*number, value.value);
+    }
+    if (const uint64_t* number = jsonValue.get_ptr<const uint64_t*>()) {
+        return details::convertFloating<Type, policy>(*number, value.value);
+    }
+    if (const int64_t* number = jsonValue.get_ptr<const int64_t*>()) {
+        return details::convertFloating<Type, policy>(*number, value.value);
+    }
+    return UnpackErrorCode::invalidType;
+}
+
+} // namespace redfish::json_util
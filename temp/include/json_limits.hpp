@@ -0,0 +1,146 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "json_utils.hpp"
+
+namespace redfish::json_util {
+
+using details::UnpackErrorCode;
+
+// Bounds on the work a single request body can cause. They are enforced
+// while the body is parsed, before any unpacking, so a hostile body is
+// rejected at the first event that crosses a limit.
+struct UnpackLimits {
+    // Arrays and objects open at the same time.
+    std::size_t maxDepth = 32;
+    std::size_t maxArrayLength = 4096;
+    std::size_t maxMembers = 1024;
+    // Sum over every string value and member name in the body.
+    std::size_t maxStringBytes = 1 << 20;
+    // nlohmann::json keeps the last of several equal member names; with this
+    // set, a repeated name fails instead.
+    bool rejectDuplicateKeys = true;
+};
+
+namespace details {
+
+struct LimitExceeded {};
+
+// Parser callback tracking one entry per open container. Throws
+// LimitExceeded to stop the parse at the first violation.
+class LimitChecker {
+  public:
+    explicit LimitChecker(const UnpackLimits& limits) : limits(limits) {}
+
+    bool operator()(int /*depth*/, nlohmann::json::parse_event_t event,
+                    nlohmann::json& parsed) {
+        using Event = nlohmann::json::parse_event_t;
+        switch (event) {
+            case Event::object_start:
+            case Event::array_start:
+                countElement();
+                if (open.size() == limits.maxDepth) {
+                    throw LimitExceeded{};
+                }
+                open.push_back({event == Event::array_start, 0});
+                if (event == Event::object_start &&
+                    limits.rejectDuplicateKeys) {
+                    names.emplace_back();
+                }
+                break;
+            case Event::object_end:
+                if (limits.rejectDuplicateKeys) {
+                    names.pop_back();
+                }
+                open.pop_back();
+                break;
+            case Event::array_end:
+                open.pop_back();
+                break;
+            case Event::key: {
+                const std::string& name = parsed.get_ref<const std::string&>();
+                countBytes(name.size());
+                if (++open.back().count > limits.maxMembers) {
+                    throw LimitExceeded{};
+                }
+                if (limits.rejectDuplicateKeys &&
+                    !names.back().insert(name).second) {
+                    throw LimitExceeded{};
+                }
+                break;
+            }
+            case Event::value:
+                countElement();
+                if (const std::string* text =
+                        parsed.get_ptr<const std::string*>()) {
+                    countBytes(text->size());
+                }
+                break;
+        }
+        return true;
+    }
+
+  private:
+    struct Container {
+        bool isArray;
+        std::size_t count;
+    };
+
+    void countElement() {
+        if (!open.empty() && open.back().isArray &&
+            ++open.back().count > limits.maxArrayLength) {
+            throw LimitExceeded{};
+        }
+    }
+
+    void countBytes(std::size_t size) {
+        stringBytes += size;
+        if (stringBytes > limits.maxStringBytes) {
+            throw LimitExceeded{};
+        }
+    }
+
+    const UnpackLimits& limits;
+    std::vector<Container> open;
+    std::vector<std::unordered_set<std::string>> names;
+    std::size_t stringBytes = 0;
+};
+
+} // namespace details
+
+// Parses body into document, enforcing limits as it goes. A violated limit
+// is outOfRange: UnpackErrorCode has no dedicated enumerator and adding one
+// would mean changing json_utils.hpp. Malformed input throws
+// nlohmann::json::parse_error, as nlohmann::json::parse() would.
+inline UnpackErrorCode parseWithLimits(std::string_view body,
+                                       const UnpackLimits& limits,
+                                       nlohmann::json& document) {
+    try {
+        document = nlohmann::json::parse(body, details::LimitChecker(limits));
+    } catch (const details::LimitExceeded&) {
+        return UnpackErrorCode::outOfRange;
+    }
+    return UnpackErrorCode::success;
+}
+
+// parseWithLimits() followed by parseValueHelper() on the whole document.
+template <typename Type>
+UnpackErrorCode unpackWithLimits(std::string_view body,
+                                 const UnpackLimits& limits,
+                                 std::string_view key, Type& value) {
+    nlohmann::json document;
+    UnpackErrorCode code = parseWithLimits(body, limits, document);
+    if (code != UnpackErrorCode::success) {
+        return code;
+    }
+    return details::parseValueHelper(document, key, value);
+}
+
+} // namespace redfish::json_util
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "json_utils.hpp"
+
+namespace redfish::json_util {
+
+using details::UnpackErrorCode;
+
+// Read-only map from member names to values, stored as one sorted vector.
+// Lookups are a binary search over contiguous entries, which beats node-based
+// maps for dictionaries that are decoded once and then only read.
+template <typename Type>
+class SortedMap {
+  public:
+    using value_type = std::pair<std::string, Type>;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    const Type* find(std::string_view name) const {
+        auto it = std::lower_bound(
+            entries.begin(), entries.end(), name,
+            [](const value_type& entry, std::string_view key) {
+                return entry.first < key;
+            });
+        if (it == entries.end() || it->first != name) {
+            return nullptr;
+        }
+        return &it->second;
+    }
+
+    bool contains(std::string_view name) const {
+        return find(name) != nullptr;
+    }
+
+    std::size_t size() const {
+        return entries.size();
+    }
+
+    bool empty() const {
+        return entries.empty();
+    }
+
+    const_iterator begin() const {
+        return entries.begin();
+    }
+
+    const_iterator end() const {
+        return entries.end();
+    }
+
+    bool operator==(const SortedMap&) const = default;
+
+  private:
+    template <typename Value>
+    friend UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                            std::string_view key,
+                                            SortedMap<Value>& value);
+
+    std::vector<value_type> entries;
+};
+
+// Hash map destination; unlike a bare std::unordered_map it is found through
+// ADL, so it also works inside std::optional and std::vector.
+template <typename Type>
+struct HashMap {
+    std::unordered_map<std::string, Type> value;
+
+    bool operator==(const HashMap&) const = default;
+};
+
+// Ordered counterpart of HashMap, with heterogeneous lookup.
+template <typename Type>
+struct OrderedMap {
+    std::map<std::string, Type, std::less<>> value;
+
+    bool operator==(const OrderedMap&) const = default;
+};
+
+namespace details {
+
+// object_t is a std::map too; it keeps going through the core overload.
+template <typename Map>
+concept StringKeyedMap = !std::is_same_v<Map, nlohmann::json::object_t>;
+
+template <typename Type, typename Hash, typename Equal, typename Allocator>
+UnpackErrorCode parseValueHelper(
+    nlohmann::json& jsonValue, std::string_view key,
+    std::unordered_map<std::string, Type, Hash, Equal, Allocator>& value);
+
+template <typename Type, typename Compare, typename Allocator>
+    requires StringKeyedMap<std::map<std::string, Type, Compare, Allocator>>
+UnpackErrorCode
+    parseValueHelper(nlohmann::json& jsonValue, std::string_view key,
+                     std::map<std::string, Type, Compare, Allocator>& value);
+
+// Decodes every member of an object into the slot insert(name) returns, in
+// member order. Stops at the first member that fails.
+template <typename Insert>
+UnpackErrorCode parseMembers(nlohmann::json& jsonValue, std::string_view key,
+                             Insert insert) {
+    nlohmann::json::object_t* object =
+        jsonValue.get_ptr<nlohmann::json::object_t*>();
+    if (object == nullptr) {
+        return UnpackErrorCode::invalidType;
+    }
+    for (auto& [name, member] : *object) {
+        UnpackErrorCode code = parseValueHelper(member, key, insert(name));
+        if (code != UnpackErrorCode::success) {
+            return code;
+        }
+    }
+    return UnpackErrorCode::success;
+}
+
+// Reserves once for the member count, so large objects never rehash.
+template <typename Map>
+UnpackErrorCode parseHashMap(nlohmann::json& jsonValue, std::string_view key,
+                             Map& value) {
+    value.clear();
+    if (const nlohmann::json::object_t* object =
+            jsonValue.get_ptr<const nlohmann::json::object_t*>()) {
+        value.reserve(object->size());
+    }
+    return parseMembers(
+        jsonValue, key,
+        [&value](const std::string& name) -> typename Map::mapped_type& {
+            return value.try_emplace(name).first->second;
+        });
+}
+
+// Members arrive in sorted order, so every insert is hinted at the end.
+template <typename Map>
+UnpackErrorCode parseOrderedMap(nlohmann::json& jsonValue, std::string_view key,
+                                Map& value) {
+    value.clear();
+    return parseMembers(
+        jsonValue, key,
+        [&value](const std::string& name) -> typename Map::mapped_type& {
+            return value.try_emplace(value.end(), name)->second;
+        });
+}
+
+template <typename Type, typename Hash, typename Equal, typename Allocator>
+UnpackErrorCode parseValueHelper(
+    nlohmann::json& jsonValue, std::string_view key,
+    std::unordered_map<std::string, Type, Hash, Equal, Allocator>& value) {
+    return parseHashMap(jsonValue, key, value);
+}
+
+template <typename Type, typename Compare, typename Allocator>
+    requires StringKeyedMap<std::map<std::string, Type, Compare, Allocator>>
+UnpackErrorCode
+    parseValueHelper(nlohmann::json& jsonValue, std::string_view key,
+                     std::map<std::string, Type, Compare, Allocator>& value) {
+    return parseOrderedMap(jsonValue, key, value);
+}
+
+} // namespace details
+
+template <typename Type>
+UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                 std::string_view key, HashMap<Type>& value) {
+    return details::parseHashMap(jsonValue, key, value.value);
+}
+
+template <typename Type>
+UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                 std::string_view key,
+                                 OrderedMap<Type>& value) {
+    return details::parseOrderedMap(jsonValue, key, value.value);
+}
+
+template <typename Type>
+UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                 std::string_view key,
+                                 SortedMap<Type>& value) {
+    std::vector<typename SortedMap<Type>::value_type>& entries = value.entries;
+    entries.clear();
+    if (const nlohmann::json::object_t* object =
+            jsonValue.get_ptr<const nlohmann::json::object_t*>()) {
+        entries.reserve(object->size());
+    }
+    // object_t is ordered by name, so appending keeps the entries sorted.
+    return details::parseMembers(
+        jsonValue, key, [&entries](const std::string& name) -> Type& {
+            return entries.emplace_back(name, Type{}).second;
+        });
+}
+
+} // namespace redfish::json_util
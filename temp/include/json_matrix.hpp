@@ -0,0 +1,101 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "json_utils.hpp"
+
+namespace redfish::json_util {
+
+using details::UnpackErrorCode;
+
+// Rectangular array of arrays, such as [[t, v], [t, v], ...], held in one
+// contiguous row-major buffer. Decoding allocates once per matrix instead of
+// once per row.
+template <typename Type = double>
+class Matrix {
+    static_assert(std::is_arithmetic_v<Type> && !std::is_same_v<Type, bool>,
+                  "Matrix elements must be numbers");
+
+  public:
+    std::size_t rows() const {
+        return rowCount;
+    }
+
+    std::size_t columns() const {
+        return columnCount;
+    }
+
+    const Type& operator()(std::size_t row, std::size_t column) const {
+        return values[row * columnCount + column];
+    }
+
+    std::span<const Type> row(std::size_t index) const {
+        return std::span<const Type>(values).subspan(index * columnCount,
+                                                     columnCount);
+    }
+
+    // All elements, row after row.
+    std::span<const Type> data() const {
+        return values;
+    }
+
+    bool operator==(const Matrix&) const = default;
+
+  private:
+    template <typename Element>
+    friend UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                            std::string_view key,
+                                            Matrix<Element>& value);
+
+    std::vector<Type> values;
+    std::size_t rowCount = 0;
+    std::size_t columnCount = 0;
+};
+
+// Every row must be an array of the first row's length; a ragged or non-array
+// row is invalidType, checked before anything is allocated. Elements decode as
+// Type does on its own.
+template <typename Type>
+UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                 std::string_view key, Matrix<Type>& value) {
+    const nlohmann::json::array_t* rows =
+        jsonValue.get_ptr<const nlohmann::json::array_t*>();
+    if (rows == nullptr) {
+        return UnpackErrorCode::invalidType;
+    }
+    std::size_t columns = 0;
+    for (std::size_t i = 0; i < rows->size(); ++i) {
+        const nlohmann::json::array_t* elements =
+            (*rows)[i].get_ptr<const nlohmann::json::array_t*>();
+        if (elements == nullptr || (i != 0 && elements->size() != columns)) {
+            return UnpackErrorCode::invalidType;
+        }
+        columns = elements->size();
+    }
+
+    std::vector<Type> values(rows->size() * columns);
+    Type* out = values.data();
+    for (nlohmann::json& row : *jsonValue.get_ptr<nlohmann::json::array_t*>()) {
+        for (nlohmann::json& element :
+             *row.get_ptr<nlohmann::json::array_t*>()) {
+            UnpackErrorCode code =
+                details::parseValueHelper(element, key, *out++);
+            if (code != UnpackErrorCode::success) {
+                return code;
+            }
+        }
+    }
+    value.values = std::move(values);
+    value.rowCount = rows->size();
+    value.columnCount = columns;
+    return UnpackErrorCode::success;
+}
+
+} // namespace redfish::json_util
@@ -0,0 +1,228 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "json_utils.hpp"
+
+namespace redfish::json_util {
+
+using details::UnpackErrorCode;
+
+// Addresses are stored in network byte order.
+struct Ipv4Address {
+    std::array<uint8_t, 4> bytes{};
+
+    // Host-order integer, e.g. 0xc0a80001 for 192.168.0.1.
+    uint32_t toUint32() const {
+        return static_cast<uint32_t>(bytes[0]) << 24 |
+               static_cast<uint32_t>(bytes[1]) << 16 |
+               static_cast<uint32_t>(bytes[2]) << 8 |
+               static_cast<uint32_t>(bytes[3]);
+    }
+
+    bool operator==(const Ipv4Address&) const = default;
+};
+
+struct Ipv6Address {
+    std::array<uint8_t, 16> bytes{};
+
+    bool operator==(const Ipv6Address&) const = default;
+};
+
+struct MacAddress {
+    std::array<uint8_t, 6> bytes{};
+
+    bool operator==(const MacAddress&) const = default;
+};
+
+namespace details {
+
+constexpr int hexDigitValue(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+} // namespace details
+
+// Dotted quad with decimal octets. Leading zeros are rejected, as inet_pton()
+// does, because some parsers read them as octal.
+inline bool parseIpv4Address(std::string_view text, Ipv4Address& value) {
+    std::array<uint8_t, 4> bytes{};
+    std::size_t pos = 0;
+    for (std::size_t octet = 0; octet < bytes.size(); ++octet) {
+        if (octet != 0) {
+            if (pos == text.size() || text[pos] != '.') {
+                return false;
+            }
+            ++pos;
+        }
+        std::size_t start = pos;
+        unsigned number = 0;
+        for (; pos < text.size() && pos - start < 3 && text[pos] >= '0' &&
+               text[pos] <= '9';
+             ++pos) {
+            number = number * 10 + static_cast<unsigned>(text[pos] - '0');
+        }
+        std::size_t digits = pos - start;
+        if (digits == 0 || number > 255 || (digits > 1 && text[start] == '0')) {
+            return false;
+        }
+        bytes[octet] = static_cast<uint8_t>(number);
+    }
+    if (pos != text.size()) {
+        return false;
+    }
+    value.bytes = bytes;
+    return true;
+}
+
+// RFC 4291 text form: eight groups of up to four hex digits, at most one "::"
+// and an optional trailing dotted quad. Zone indices ("%eth0") are rejected.
+inline bool parseIpv6Address(std::string_view text, Ipv6Address& value) {
+    std::array<uint8_t, 16> bytes{};
+    std::size_t filled = 0;
+    std::size_t gap = bytes.size() + 1;
+    std::size_t pos = 0;
+    if (text.starts_with("::")) {
+        gap = 0;
+        pos = 2;
+    } else if (text.starts_with(":")) {
+        return false;
+    }
+    bool expectGroup = gap != 0;
+    while (pos < text.size()) {
+        std::size_t start = pos;
+        unsigned group = 0;
+        for (; pos < text.size() && pos - start < 4; ++pos) {
+            int digit = details::hexDigitValue(text[pos]);
+            if (digit < 0) {
+                break;
+            }
+            group = group << 4 | static_cast<unsigned>(digit);
+        }
+        if (pos < text.size() && text[pos] == '.') {
+            // The rest is an embedded IPv4 address filling the last 4 bytes.
+            Ipv4Address embedded;
+            if (filled + 4 > bytes.size() ||
+                !parseIpv4Address(text.substr(start), embedded)) {
+                return false;
+            }
+            for (uint8_t byte : embedded.bytes) {
+                bytes[filled++] = byte;
+            }
+            pos = text.size();
+            expectGroup = false;
+            break;
+        }
+        if (pos == start || filled + 2 > bytes.size()) {
+            return false;
+        }
+        bytes[filled++] = static_cast<uint8_t>(group >> 8);
+        bytes[filled++] = static_cast<uint8_t>(group);
+        expectGroup = false;
+        if (pos == text.size()) {
+            break;
+        }
+        if (text[pos] != ':') {
+            return false;
+        }
+        ++pos;
+        if (pos < text.size() && text[pos] == ':') {
+            if (gap <= bytes.size()) {
+                return false;
+            }
+            gap = filled;
+            ++pos;
+        } else {
+            expectGroup = true;
+        }
+    }
+    if (expectGroup) {
+        return false;
+    }
+    if (gap <= bytes.size()) {
+        // "::" must stand for at least one zero group.
+        if (filled == bytes.size()) {
+            return false;
+        }
+        // Move the groups after "::" to the end, zeroing their old place.
+        std::size_t tail = filled - gap;
+        for (std::size_t i = 0; i < tail; ++i) {
+            bytes[bytes.size() - 1 - i] = bytes[filled - 1 - i];
+            bytes[filled - 1 - i] = 0;
+        }
+    } else if (filled != bytes.size()) {
+        return false;
+    }
+    value.bytes = bytes;
+    return true;
+}
+
+// Six pairs of hex digits separated by ':' or '-', the Redfish MACAddress
+// pattern.
+inline bool parseMacAddress(std::string_view text, MacAddress& value) {
+    if (text.size() != 17) {
+        return false;
+    }
+    std::array<uint8_t, 6> bytes{};
+    for (std::size_t i = 0; i < bytes.size(); ++i) {
+        const char* pair = text.data() + i * 3;
+        int high = details::hexDigitValue(pair[0]);
+        int low = details::hexDigitValue(pair[1]);
+        if (high < 0 || low < 0 ||
+            (i != 0 && pair[-1] != ':' && pair[-1] != '-')) {
+            return false;
+        }
+        bytes[i] = static_cast<uint8_t>(high << 4 | low);
+    }
+    value.bytes = bytes;
+    return true;
+}
+
+namespace details {
+
+template <typename Address>
+UnpackErrorCode parseAddress(const nlohmann::json& jsonValue, Address& value,
+                             bool (*parse)(std::string_view, Address&)) {
+    const std::string* text = jsonValue.get_ptr<const std::string*>();
+    if (text == nullptr || !parse(*text, value)) {
+        return UnpackErrorCode::invalidType;
+    }
+    return UnpackErrorCode::success;
+}
+
+} // namespace details
+
+inline UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                        std::string_view /*key*/,
+                                        Ipv4Address& value) {
+    return details::parseAddress(jsonValue, value, parseIpv4Address);
+}
+
+inline UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                        std::string_view /*key*/,
+                                        Ipv6Address& value) {
+    return details::parseAddress(jsonValue, value, parseIpv6Address);
+}
+
+inline UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                        std::string_view /*key*/,
+                                        MacAddress& value) {
+    return details::parseAddress(jsonValue, value, parseMacAddress);
+}
+
+} // namespace redfish::json_util
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "json_utils.hpp"
+
+// Destination types whose parseValueHelper is instantiated once, in the
+// json_registry library, instead of in every translation unit that unpacks
+// them. Add a type here when it is used from more than one file; each entry
+// is X(Type), and commas inside Type are fine.
+//
+// The declarations below name parseValueHelper<Type>(nlohmann::json&,
+// std::string_view, Type&) and must match json_utils.hpp exactly, so the
+// registry is opt-in (ENABLE_JSON_REGISTRY) and no existing source includes
+// it by default.
+#define REDFISH_JSON_REGISTERED_TYPES(X)                                       \
+    X(bool)                                                                    \
+    X(uint8_t)                                                                 \
+    X(uint16_t)                                                                \
+    X(uint32_t)                                                                \
+    X(uint64_t)                                                                \
+    X(int16_t)                                                                 \
+    X(int32_t)                                                                 \
+    X(int64_t)                                                                 \
+    X(double)                                                                  \
+    X(std::string)                                                             \
+    X(nlohmann::json)                                                          \
+    X(nlohmann::json::object_t)                                                \
+    X(std::optional<uint8_t>)                                                  \
+    X(std::optional<double>)                                                   \
+    X(std::optional<std::string>)                                              \
+    X(std::optional<nlohmann::json>)                                           \
+    X(std::optional<nlohmann::json::object_t>)                                 \
+    X(std::vector<uint8_t>)                                                    \
+    X(std::vector<uint16_t>)                                                   \
+    X(std::vector<uint32_t>)                                                   \
+    X(std::vector<uint64_t>)                                                   \
+    X(std::vector<int16_t>)                                                    \
+    X(std::vector<int32_t>)                                                    \
+    X(std::vector<int64_t>)                                                    \
+    X(std::vector<double>)                                                     \
+    X(std::vector<std::string>)                                                \
+    X(std::vector<nlohmann::json>)                                             \
+    X(std::vector<nlohmann::json::object_t>)                                   \
+    X(std::optional<std::vector<uint8_t>>)                                     \
+    X(std::optional<std::vector<int64_t>>)                                     \
+    X(std::optional<std::vector<double>>)                                      \
+    X(std::optional<std::vector<std::string>>)                                 \
+    X(std::optional<std::vector<nlohmann::json>>)                              \
+    X(std::optional<std::vector<nlohmann::json::object_t>>)                    \
+    X(std::variant<bool, std::nullptr_t>)                                      \
+    X(std::variant<uint8_t, std::nullptr_t>)                                   \
+    X(std::variant<uint16_t, std::nullptr_t>)                                  \
+    X(std::variant<uint32_t, std::nullptr_t>)                                  \
+    X(std::variant<uint64_t, std::nullptr_t>)                                  \
+    X(std::variant<int16_t, std::nullptr_t>)                                   \
+    X(std::variant<int32_t, std::nullptr_t>)                                   \
+    X(std::variant<int64_t, std::nullptr_t>)                                   \
+    X(std::variant<double, std::nullptr_t>)                                    \
+    X(std::variant<std::string, std::nullptr_t>)                               \
+    X(std::optional<std::variant<bool, std::nullptr_t>>)                       \
+    X(std::optional<std::variant<uint8_t, std::nullptr_t>>)                    \
+    X(std::optional<std::variant<uint16_t, std::nullptr_t>>)                   \
+    X(std::optional<std::variant<uint32_t, std::nullptr_t>>)                   \
+    X(std::optional<std::variant<uint64_t, std::nullptr_t>>)                   \
+    X(std::optional<std::variant<int16_t, std::nullptr_t>>)                    \
+    X(std::optional<std::variant<int32_t, std::nullptr_t>>)                    \
+    X(std::optional<std::variant<int64_t, std::nullptr_t>>)                    \
+    X(std::optional<std::variant<double, std::nullptr_t>>)                     \
+    X(std::optional<std::variant<std::string, std::nullptr_t>>)                \
+    X(std::optional<std::vector<                                               \
+          std::variant<nlohmann::json::object_t, std::nullptr_t>>>)            \
+    X(std::optional<std::vector<std::variant<                                  \
+          std::string, nlohmann::json::object_t, std::nullptr_t>>>)
+
+#define REDFISH_JSON_DECLARE_REGISTERED(...)                                   \
+    extern template UnpackErrorCode parseValueHelper<__VA_ARGS__>(             \
+        nlohmann::json & jsonValue, std::string_view key,                      \
+        __VA_ARGS__ & value);
+
+#define REDFISH_JSON_LIST_REGISTERED(...) __VA_ARGS__,
+
+namespace redfish::json_util {
+
+namespace details {
+
+REDFISH_JSON_REGISTERED_TYPES(REDFISH_JSON_DECLARE_REGISTERED)
+
+// Ends the list after the macro's trailing comma; never a destination.
+struct RegistryEnd;
+
+using RegisteredDestinations = std::tuple<
+    REDFISH_JSON_REGISTERED_TYPES(REDFISH_JSON_LIST_REGISTERED) RegistryEnd>;
+
+template <typename Type, typename List>
+struct IsRegistered;
+
+template <typename Type, typename... Types>
+struct IsRegistered<Type, std::tuple<Types...>> :
+    std::bool_constant<(std::is_same_v<Type, Types> || ...)> {};
+
+} // namespace details
+
+template <typename Type>
+constexpr bool isRegisteredDestination =
+    details::IsRegistered<Type, details::RegisteredDestinations>::value;
+
+// parseValueHelper restricted to registered types, so a new destination type
+// fails to compile instead of silently adding another instantiation tree.
+template <typename Type>
+details::UnpackErrorCode unpackRegistered(nlohmann::json& jsonValue,
+                                          std::string_view key, Type& value) {
+    static_assert(isRegisteredDestination<Type>,
+                  "add Type to REDFISH_JSON_REGISTERED_TYPES");
+    return details::parseValueHelper(jsonValue, key, value);
+}
+
+} // namespace redfish::json_util
+
+#undef REDFISH_JSON_DECLARE_REGISTERED
+#undef REDFISH_JSON_LIST_REGISTERED
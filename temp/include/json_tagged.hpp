@@ -0,0 +1,148 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+#include "json_enum.hpp"
+#include "json_utils.hpp"
+
+namespace redfish::json_util {
+
+using details::UnpackErrorCode;
+
+// String literal usable as a template argument, naming the discriminator
+// member of a TaggedVariant.
+template <std::size_t N>
+struct TagKey {
+    char chars[N]{};
+
+    constexpr TagKey(const char (&text)[N]) {
+        std::copy_n(text, N, chars);
+    }
+
+    constexpr std::string_view view() const {
+        return {chars, N - 1};
+    }
+};
+
+// Object destination holding one of several structs, chosen by the string in
+// its key member before anything else is decoded. Each alternative declares
+//
+//   static constexpr std::string_view discriminator = "...";
+//
+// and has a parseValueHelper overload found through ADL, which then decodes
+// the whole object once. Objects whose discriminator is missing, not a string
+// or not listed are invalidType.
+//
+// With the key "@odata.type" the version segment is dropped before the
+// lookup, so "#Chassis.v1_14_0.Chassis" selects the alternative whose
+// discriminator is "#Chassis.Chassis".
+template <TagKey key, typename... Alternatives>
+struct TaggedVariant {
+    static_assert(sizeof...(Alternatives) > 0,
+                  "TaggedVariant needs at least one alternative");
+
+    std::variant<Alternatives...> value;
+};
+
+template <typename... Alternatives>
+using ODataVariant = TaggedVariant<"@odata.type", Alternatives...>;
+
+namespace details {
+
+// Longest @odata.type that is matched without its version segment.
+constexpr std::size_t maxODataTypeSize = 128;
+
+// "#Namespace.vX_Y_Z.Type" -> "#Namespace.Type". Values without a version
+// segment, or too long for buffer, are returned unchanged.
+inline std::string_view
+    unversionedODataType(std::string_view type,
+                         std::array<char, maxODataTypeSize>& buffer) {
+    std::size_t first = type.find('.');
+    if (first == std::string_view::npos || first + 2 >= type.size() ||
+        type[first + 1] != 'v' || type[first + 2] < '0' ||
+        type[first + 2] > '9') {
+        return type;
+    }
+    std::size_t second = type.find('.', first + 1);
+    if (second == std::string_view::npos) {
+        return type;
+    }
+    std::size_t size = type.size() - (second - first);
+    if (size > buffer.size()) {
+        return type;
+    }
+    std::memcpy(buffer.data(), type.data(), first);
+    std::memcpy(buffer.data() + first, type.data() + second,
+                type.size() - second);
+    return {buffer.data(), size};
+}
+
+template <typename... Alternatives, std::size_t... indexes>
+constexpr auto makeTagTable(std::index_sequence<indexes...> /*indexes*/) {
+    return EnumTable<std::size_t, sizeof...(Alternatives)>(
+        std::array<EnumString<std::size_t>, sizeof...(Alternatives)>{
+            EnumString<std::size_t>{Alternatives::discriminator, indexes}...});
+}
+
+template <typename Variant, std::size_t... indexes>
+UnpackErrorCode parseAlternative(nlohmann::json& jsonValue, std::string_view key,
+                                 std::size_t index, Variant& value,
+                                 std::index_sequence<indexes...> /*indexes*/) {
+    UnpackErrorCode code = UnpackErrorCode::invalidType;
+    ((index == indexes
+          ? (code = parseValueHelper(jsonValue, key,
+                                     value.template emplace<indexes>()),
+             true)
+          : false) ||
+     ...);
+    return code;
+}
+
+} // namespace details
+
+template <TagKey key, typename... Alternatives>
+UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                 std::string_view fieldKey,
+                                 TaggedVariant<key, Alternatives...>& value) {
+    static constexpr auto table = details::makeTagTable<Alternatives...>(
+        std::index_sequence_for<Alternatives...>{});
+    const nlohmann::json::object_t* object =
+        jsonValue.get_ptr<const nlohmann::json::object_t*>();
+    if (object == nullptr) {
+        return UnpackErrorCode::invalidType;
+    }
+    auto member = object->find(key.view());
+    if (member == object->end()) {
+        return UnpackErrorCode::invalidType;
+    }
+    const std::string* tag =
+        member->second.template get_ptr<const std::string*>();
+    if (tag == nullptr) {
+        return UnpackErrorCode::invalidType;
+    }
+    std::optional<std::size_t> index;
+    if constexpr (key.view() == "@odata.type") {
+        std::array<char, details::maxODataTypeSize> buffer;
+        index = table.find(details::unversionedODataType(*tag, buffer));
+    } else {
+        index = table.find(*tag);
+    }
+    if (!index) {
+        return UnpackErrorCode::invalidType;
+    }
+    return details::parseAlternative(
+        jsonValue, fieldKey, *index, value.value,
+        std::index_sequence_for<Alternatives...>{});
+}
+
+} // namespace redfish::json_util
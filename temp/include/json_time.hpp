@@ -0,0 +1,317 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "json_utils.hpp"
+
+namespace redfish::json_util {
+
+using details::UnpackErrorCode;
+
+// ISO 8601 date-time such as "2026-10-17T12:00:00.250+02:00", normalized to
+// UTC. Fractional seconds finer than Duration are truncated; instants outside
+// the range of Duration are outOfRange.
+template <typename Duration = std::chrono::seconds>
+struct DateTime {
+    std::chrono::sys_time<Duration> value{};
+
+    bool operator==(const DateTime&) const = default;
+};
+
+// ISO 8601 duration in the form Redfish uses, -?PnDTnHnMn.nS, such as "PT5M".
+// Year, month and week designators are rejected because their length is not
+// fixed.
+template <typename Duration = std::chrono::seconds>
+struct IsoDuration {
+    Duration value{};
+
+    bool operator==(const IsoDuration&) const = default;
+};
+
+namespace details {
+
+inline uint64_t loadTimeWord(const char* text) {
+    uint64_t word = 0;
+    std::memcpy(&word, text, sizeof(word));
+    return word;
+}
+
+constexpr char dateTimeLayout[] = "0000-00-00T00:00:00";
+
+// Per-byte masks over the first 16 layout characters: 0x80 marks a digit
+// position in digitBytes and 0xff marks a separator in separatorBytes.
+constexpr std::array<char, 16> dateTimeMask(bool digits) {
+    std::array<char, 16> mask{};
+    for (std::size_t i = 0; i < mask.size(); ++i) {
+        bool isDigitPosition = dateTimeLayout[i] == '0';
+        if (isDigitPosition == digits) {
+            mask[i] = static_cast<char>(digits ? 0x80 : 0xff);
+        }
+    }
+    return mask;
+}
+
+// Checks the fixed "YYYY-MM-DDTHH:MM:SS" prefix eight bytes at a time. Each
+// byte is XOR-ed with the layout, which leaves separators at zero and turns
+// digits into their value, so one add-and-mask step validates every digit of
+// a word without branches. A carry between bytes can only start from a byte
+// that is already invalid, so it never hides an error.
+inline bool readDateTimeFields(const char* text, int (&fields)[6]) {
+    static constexpr std::array<char, 16> digitBytes = dateTimeMask(true);
+    static constexpr std::array<char, 16> separatorBytes = dateTimeMask(false);
+    const char* layout = dateTimeLayout;
+    uint8_t values[19] = {};
+    bool valid = true;
+    for (std::size_t word = 0; word < 2; ++word) {
+        uint64_t x = loadTimeWord(text + word * 8) ^
+                     loadTimeWord(layout + word * 8);
+        uint64_t overNine = (x | (x + 0x7676767676767676ULL)) &
+                            loadTimeWord(digitBytes.data() + word * 8);
+        valid = valid && overNine == 0 &&
+                (x & loadTimeWord(separatorBytes.data() + word * 8)) == 0;
+        std::memcpy(values + word * 8, &x, sizeof(x));
+    }
+    for (std::size_t i = 16; i < 19; ++i) {
+        values[i] = static_cast<uint8_t>(text[i] ^ layout[i]);
+        valid = valid && (i == 16 ? values[i] == 0 : values[i] <= 9);
+    }
+    if (!valid) {
+        return false;
+    }
+    fields[0] = values[0] * 1000 + values[1] * 100 + values[2] * 10 + values[3];
+    fields[1] = values[5] * 10 + values[6];
+    fields[2] = values[8] * 10 + values[9];
+    fields[3] = values[11] * 10 + values[12];
+    fields[4] = values[14] * 10 + values[15];
+    fields[5] = values[17] * 10 + values[18];
+    return true;
+}
+
+inline bool isDigit(char c) {
+    return static_cast<unsigned char>(c - '0') <= 9;
+}
+
+// Reads up to nine fraction digits as nanoseconds and skips the rest.
+inline std::chrono::nanoseconds readFraction(std::string_view text,
+                                             std::size_t& pos) {
+    int64_t nanos = 0;
+    std::size_t digits = 0;
+    for (; pos < text.size() && isDigit(text[pos]); ++pos, ++digits) {
+        if (digits < 9) {
+            nanos = nanos * 10 + (text[pos] - '0');
+        }
+    }
+    for (; digits < 9; ++digits) {
+        nanos *= 10;
+    }
+    return std::chrono::nanoseconds(nanos);
+}
+
+// Sets value to whole + fraction in Duration, floored, or returns false when
+// that is outside Duration's range. whole is first compared in long double
+// seconds, which cannot overflow for any period or rep; anything short of one
+// unit past max() still floors to max().
+template <typename Duration>
+bool toDuration(std::chrono::seconds whole, std::chrono::nanoseconds fraction,
+                Duration& value) {
+    using namespace std::chrono;
+    using Seconds = duration<long double>;
+    if (Seconds(whole) < Seconds(Duration::min()) ||
+        Seconds(whole) >= Seconds(Duration::max()) + Seconds(Duration(1))) {
+        return false;
+    }
+    Duration base = floor<Duration>(whole);
+    Duration part = floor<Duration>(fraction);
+    if (base > Duration::max() - part) {
+        return false;
+    }
+    value = base + part;
+    return true;
+}
+
+} // namespace details
+
+template <typename Duration>
+UnpackErrorCode parseDateTime(std::string_view text,
+                              std::chrono::sys_time<Duration>& value) {
+    using namespace std::chrono;
+    int fields[6] = {};
+    if (text.size() < 20 || !details::readDateTimeFields(text.data(), fields)) {
+        return UnpackErrorCode::invalidType;
+    }
+    std::size_t pos = 19;
+    nanoseconds fraction{};
+    if (text[pos] == '.') {
+        ++pos;
+        if (pos == text.size() || !details::isDigit(text[pos])) {
+            return UnpackErrorCode::invalidType;
+        }
+        fraction = details::readFraction(text, pos);
+    }
+
+    minutes offset{};
+    if (pos + 1 == text.size() && text[pos] == 'Z') {
+        ++pos;
+    } else if (pos + 6 == text.size() &&
+               (text[pos] == '+' || text[pos] == '-') &&
+               details::isDigit(text[pos + 1]) &&
+               details::isDigit(text[pos + 2]) && text[pos + 3] == ':' &&
+               details::isDigit(text[pos + 4]) &&
+               details::isDigit(text[pos + 5])) {
+        int offsetHours = (text[pos + 1] - '0') * 10 + (text[pos + 2] - '0');
+        int offsetMinutes = (text[pos + 4] - '0') * 10 + (text[pos + 5] - '0');
+        if (offsetHours > 23 || offsetMinutes > 59) {
+            return UnpackErrorCode::outOfRange;
+        }
+        offset = hours(offsetHours) + minutes(offsetMinutes);
+        if (text[pos] == '-') {
+            offset = -offset;
+        }
+    } else {
+        return UnpackErrorCode::invalidType;
+    }
+
+    year_month_day date{year(fields[0]),
+                        month(static_cast<unsigned>(fields[1])),
+                        day(static_cast<unsigned>(fields[2]))};
+    if (!date.ok() || fields[3] > 23 || fields[4] > 59 || fields[5] > 59) {
+        return UnpackErrorCode::outOfRange;
+    }
+    sys_seconds wholeSeconds = sys_days(date) + hours(fields[3]) +
+                               minutes(fields[4]) + seconds(fields[5]) - offset;
+    Duration sinceEpoch{};
+    if (!details::toDuration(wholeSeconds.time_since_epoch(), fraction,
+                             sinceEpoch)) {
+        return UnpackErrorCode::outOfRange;
+    }
+    value = sys_time<Duration>(sinceEpoch);
+    return UnpackErrorCode::success;
+}
+
+template <typename Duration>
+UnpackErrorCode parseIsoDuration(std::string_view text, Duration& value) {
+    using namespace std::chrono;
+    // Components are capped well below the point where the seconds total
+    // could overflow int64_t.
+    constexpr int64_t maxComponent = 999'999'999'999;
+    std::size_t pos = 0;
+    bool negative = false;
+    if (pos < text.size() && text[pos] == '-') {
+        negative = true;
+        ++pos;
+    }
+    if (pos == text.size() || text[pos] != 'P') {
+        return UnpackErrorCode::invalidType;
+    }
+    ++pos;
+
+    seconds total{};
+    nanoseconds fraction{};
+    bool inTime = false;
+    bool anyComponent = false;
+    // Designators must appear in this order, each at most once.
+    std::string_view remaining = "DHMS";
+    while (pos < text.size()) {
+        if (text[pos] == 'T') {
+            if (inTime) {
+                return UnpackErrorCode::invalidType;
+            }
+            inTime = true;
+            remaining = "HMS";
+            ++pos;
+            if (pos == text.size()) {
+                return UnpackErrorCode::invalidType;
+            }
+            continue;
+        }
+        if (!details::isDigit(text[pos])) {
+            return UnpackErrorCode::invalidType;
+        }
+        int64_t number = 0;
+        for (; pos < text.size() && details::isDigit(text[pos]); ++pos) {
+            if (number > maxComponent) {
+                return UnpackErrorCode::outOfRange;
+            }
+            number = number * 10 + (text[pos] - '0');
+        }
+        if (number > maxComponent) {
+            return UnpackErrorCode::outOfRange;
+        }
+        nanoseconds componentFraction{};
+        if (pos < text.size() && text[pos] == '.') {
+            ++pos;
+            if (pos == text.size() || !details::isDigit(text[pos])) {
+                return UnpackErrorCode::invalidType;
+            }
+            componentFraction = details::readFraction(text, pos);
+        }
+        if (pos == text.size()) {
+            return UnpackErrorCode::invalidType;
+        }
+        char designator = text[pos++];
+        std::size_t order = remaining.find(designator);
+        if (order == std::string_view::npos ||
+            (designator == 'D') == inTime ||
+            (componentFraction.count() != 0 && designator != 'S')) {
+            return UnpackErrorCode::invalidType;
+        }
+        remaining.remove_prefix(order + 1);
+        switch (designator) {
+            case 'D':
+                total += days(number);
+                break;
+            case 'H':
+                total += hours(number);
+                break;
+            case 'M':
+                total += minutes(number);
+                break;
+            default:
+                total += seconds(number);
+                fraction = componentFraction;
+                break;
+        }
+        anyComponent = true;
+    }
+    if (!anyComponent) {
+        return UnpackErrorCode::invalidType;
+    }
+    Duration result{};
+    if (!details::toDuration(total, fraction, result)) {
+        return UnpackErrorCode::outOfRange;
+    }
+    value = negative ? -result : result;
+    return UnpackErrorCode::success;
+}
+
+template <typename Duration>
+UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                 std::string_view /*key*/,
+                                 DateTime<Duration>& value) {
+    const std::string* text = jsonValue.get_ptr<const std::string*>();
+    if (text == nullptr) {
+        return UnpackErrorCode::invalidType;
+    }
+    return parseDateTime(*text, value.value);
+}
+
+template <typename Duration>
+UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                 std::string_view /*key*/,
+                                 IsoDuration<Duration>& value) {
+    const std::string* text = jsonValue.get_ptr<const std::string*>();
+    if (text == nullptr) {
+        return UnpackErrorCode::invalidType;
+    }
+    return parseIsoDuration(*text, value.value);
+}
+
+} // namespace redfish::json_util
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include "json_utils.hpp"
+
+namespace redfish::json_util {
+
+using details::UnpackErrorCode;
+
+// Positional record such as [timestamp, value, status], unpacked element by
+// element into value. Being a json_util type it is found through ADL, so
+// records work inside std::optional, std::vector and other records. Plain
+// std::tuple and std::pair destinations are also accepted, at the top level
+// and as elements of a Record, tuple or pair, but not inside the containers
+// the core unpacks.
+template <typename... Types>
+struct Record {
+    std::tuple<Types...> value;
+
+    bool operator==(const Record&) const = default;
+};
+
+namespace details {
+
+template <typename... Types>
+UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                 std::string_view key,
+                                 std::tuple<Types...>& value);
+
+template <typename First, typename Second>
+UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                 std::string_view key,
+                                 std::pair<First, Second>& value);
+
+// Decodes element i of a positional array straight into std::get<i>(value).
+// The array must have exactly one element per position; a longer or shorter
+// array is invalidType. Decoding stops at the first element that fails.
+template <typename Tuple, std::size_t... indexes>
+UnpackErrorCode parseElements(nlohmann::json& jsonValue, std::string_view key,
+                              Tuple& value,
+                              std::index_sequence<indexes...> /*indexes*/) {
+    nlohmann::json::array_t* array =
+        jsonValue.get_ptr<nlohmann::json::array_t*>();
+    if (array == nullptr || array->size() != sizeof...(indexes)) {
+        return UnpackErrorCode::invalidType;
+    }
+    UnpackErrorCode code = UnpackErrorCode::success;
+    ((code = parseValueHelper((*array)[indexes], key,
+                              std::get<indexes>(value)),
+      code == UnpackErrorCode::success) &&
+     ...);
+    return code;
+}
+
+template <typename... Types>
+UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                 std::string_view key,
+                                 std::tuple<Types...>& value) {
+    return parseElements(jsonValue, key, value,
+                         std::index_sequence_for<Types...>{});
+}
+
+template <typename First, typename Second>
+UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                 std::string_view key,
+                                 std::pair<First, Second>& value) {
+    return parseElements(jsonValue, key, value, std::make_index_sequence<2>{});
+}
+
+} // namespace details
+
+template <typename... Types>
+UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                 std::string_view key,
+                                 Record<Types...>& value) {
+    return details::parseElements(jsonValue, key, value.value,
+                                  std::index_sequence_for<Types...>{});
+}
+
+} // namespace redfish::json_util
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include "json_binary.hpp"
+#include "json_utils.hpp"
+
+namespace redfish::json_util {
+
+using details::UnpackErrorCode;
+
+// 128-bit identifier such as a Redfish "UUID" property, stored as its 16
+// bytes in text order. Orders byte by byte, which matches the order of the
+// canonical strings, and hashes as two 64-bit words, so it can key ordered
+// and unordered containers without holding a string.
+struct Uuid {
+    std::array<uint8_t, 16> bytes{};
+
+    // Canonical lowercase form, e.g. "123e4567-e89b-12d3-a456-426614174000".
+    std::string toString() const {
+        static constexpr char digits[] = "0123456789abcdef";
+        std::string text;
+        text.reserve(36);
+        for (std::size_t i = 0; i < bytes.size(); ++i) {
+            if (i == 4 || i == 6 || i == 8 || i == 10) {
+                text += '-';
+            }
+            text += digits[bytes[i] >> 4];
+            text += digits[bytes[i] & 0x0f];
+        }
+        return text;
+    }
+
+    auto operator<=>(const Uuid&) const = default;
+};
+
+// Parses the 36-character 8-4-4-4-12 form in either letter case. Braces, URN
+// prefixes and the 32-digit form without hyphens are rejected.
+inline bool parseUuid(std::string_view text, Uuid& value) {
+    if (text.size() != 36 || text[8] != '-' || text[13] != '-' ||
+        text[18] != '-' || text[23] != '-') {
+        return false;
+    }
+    // Drop the hyphens so the 32 digits decode as one hex block.
+    char digits[32];
+    std::memcpy(digits, text.data(), 8);
+    std::memcpy(digits + 8, text.data() + 9, 4);
+    std::memcpy(digits + 12, text.data() + 14, 4);
+    std::memcpy(digits + 16, text.data() + 19, 4);
+    std::memcpy(digits + 20, text.data() + 24, 12);
+    return details::decodeHexRun(digits, value.bytes.data(), value.bytes.size());
+}
+
+inline UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue,
+                                        std::string_view /*key*/, Uuid& value) {
+    const std::string* text = jsonValue.get_ptr<const std::string*>();
+    if (text == nullptr || !parseUuid(*text, value)) {
+        return UnpackErrorCode::invalidType;
+    }
+    return UnpackErrorCode::success;
+}
+
+} // namespace redfish::json_util
+
+template <>
+struct std::hash<redfish::json_util::Uuid> {
+    std::size_t operator()(const redfish::json_util::Uuid& uuid) const noexcept {
+        uint64_t high = 0;
+        uint64_t low = 0;
+        std::memcpy(&high, uuid.bytes.data(), sizeof(high));
+        std::memcpy(&low, uuid.bytes.data() + 8, sizeof(low));
+        // Version and variant bits sit in fixed places, so mix both halves
+        // rather than taking either one alone.
+        uint64_t hash = high ^ (low * 0x9e3779b97f4a7c15ULL);
+        hash ^= hash >> 32;
+        return static_cast<std::size_t>(hash);
+    }
+};
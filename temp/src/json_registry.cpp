@@ -0,0 +1,12 @@
+#include "json_registry.hpp"
+
+#define REDFISH_JSON_INSTANTIATE_REGISTERED(...)                               \
+    template UnpackErrorCode parseValueHelper<__VA_ARGS__>(                    \
+        nlohmann::json & jsonValue, std::string_view key,                      \
+        __VA_ARGS__ & value);
+
+namespace redfish::json_util::details {
+
+REDFISH_JSON_REGISTERED_TYPES(REDFISH_JSON_INSTANTIATE_REGISTERED)
+
+} // namespace redfish::json_util::details
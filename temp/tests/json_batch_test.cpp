@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include "json_batch.hpp"
+
+using namespace redfish::json_util;
+
+TEST(ParseBatchTest, ParseVectorUint16Documents) {
+    std::vector<nlohmann::json> documents = {{1, 2}, {3}, nlohmann::json::array()};
+    std::vector<std::vector<uint16_t>> values;
+    BatchContext context;
+    EXPECT_EQ(parseBatch(context, std::span(documents), "field key", values), UnpackErrorCode::success);
+    EXPECT_FALSE(context.hasErrors());
+    ASSERT_EQ(values.size(), 3u);
+    EXPECT_EQ(values[0], std::vector<uint16_t>({1, 2}));
+    EXPECT_EQ(values[1], std::vector<uint16_t>({3}));
+    EXPECT_TRUE(values[2].empty());
+}
+
+TEST(ParseBatchTest, RecordsEveryFailingDocument) {
+    std::vector<nlohmann::json> documents = {"one", 2, "three", nullptr};
+    std::vector<std::string> values;
+    BatchContext context;
+    EXPECT_EQ(parseBatch(context, std::span(documents), "field key", values), UnpackErrorCode::invalidType);
+    ASSERT_EQ(context.getErrors().size(), 2u);
+    EXPECT_EQ(context.getErrors()[0].index, 1u);
+    EXPECT_EQ(context.getErrors()[1].index, 3u);
+    EXPECT_EQ(values[0], "one");
+    EXPECT_EQ(values[2], "three");
+}
+
+TEST(ParseBatchTest, ReusedContextIsClearedBetweenBatches) {
+    std::vector<nlohmann::json> bad = {"not a number"};
+    std::vector<nlohmann::json> good = {1, 2};
+    std::vector<uint8_t> values;
+    BatchContext context(4);
+    EXPECT_NE(parseBatch(context, std::span(bad), "field key", values), UnpackErrorCode::success);
+    EXPECT_TRUE(context.hasErrors());
+    EXPECT_EQ(parseBatch(context, std::span(good), "field key", values), UnpackErrorCode::success);
+    EXPECT_FALSE(context.hasErrors());
+    EXPECT_EQ(values, std::vector<uint8_t>({1, 2}));
+}
+
+TEST(ParseBatchTest, ParseBoolDocuments) {
+    std::vector<nlohmann::json> documents = {true, false, "yes", true};
+    std::vector<bool> values;
+    BatchContext context;
+    EXPECT_EQ(parseBatch(context, std::span(documents), "field key", values), UnpackErrorCode::invalidType);
+    ASSERT_EQ(context.getErrors().size(), 1u);
+    EXPECT_EQ(context.getErrors()[0].index, 2u);
+    EXPECT_EQ(values, std::vector<bool>({true, false, false, true}));
+}
+
+TEST(ParseBatchTest, FailedSlotDoesNotKeepPreviousValue) {
+    std::vector<nlohmann::json> first = {"one", "two"};
+    std::vector<nlohmann::json> second = {"uno", 2};
+    std::vector<std::string> values;
+    BatchContext context;
+    EXPECT_EQ(parseBatch(context, std::span(first), "field key", values), UnpackErrorCode::success);
+    EXPECT_EQ(parseBatch(context, std::span(second), "field key", values), UnpackErrorCode::invalidType);
+    EXPECT_EQ(values, std::vector<std::string>({"uno", ""}));
+}
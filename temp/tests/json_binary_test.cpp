@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include "json_binary.hpp"
+
+#include <random>
+
+using namespace redfish::json_util::details;
+using redfish::json_util::Base64Bytes;
+using redfish::json_util::Base64UrlBytes;
+using redfish::json_util::HexBytes;
+
+namespace {
+
+std::vector<std::byte> toBytes(std::string_view text) {
+    std::vector<std::byte> bytes;
+    for (char c : text) {
+        bytes.push_back(static_cast<std::byte>(c));
+    }
+    return bytes;
+}
+
+std::string encodeBase64(const std::vector<std::byte>& bytes, bool url, bool pad) {
+    const char* alphabet = url ? "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"
+                               : "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string text;
+    for (std::size_t i = 0; i < bytes.size(); i += 3) {
+        uint32_t bits = std::to_integer<uint32_t>(bytes[i]) << 16;
+        std::size_t count = std::min<std::size_t>(3, bytes.size() - i);
+        if (count > 1) {
+            bits |= std::to_integer<uint32_t>(bytes[i + 1]) << 8;
+        }
+        if (count > 2) {
+            bits |= std::to_integer<uint32_t>(bytes[i + 2]);
+        }
+        for (std::size_t j = 0; j < count + 1; ++j) {
+            text += alphabet[(bits >> (18 - 6 * j)) & 0x3f];
+        }
+        if (pad) {
+            text.append(3 - count, '=');
+        }
+    }
+    return text;
+}
+
+std::vector<std::byte> randomBytes(std::size_t size) {
+    std::mt19937 generator(static_cast<unsigned>(size));
+    std::vector<std::byte> bytes(size);
+    for (std::byte& byte : bytes) {
+        byte = static_cast<std::byte>(generator());
+    }
+    return bytes;
+}
+
+} // namespace
+
+TEST(ParseValueHelperTest, ParseBase64) {
+    const std::pair<const char*, const char*> vectors[] = {
+        {"", ""}, {"Zg==", "f"}, {"Zm8=", "fo"}, {"Zm9v", "foo"},
+        {"Zm9vYg==", "foob"}, {"Zm9vYmE=", "fooba"}, {"Zm9vYmFy", "foobar"}};
+    for (const auto& [text, expected] : vectors) {
+        nlohmann::json jsonValue = text;
+        Base64Bytes value;
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success) << text;
+        EXPECT_EQ(value.bytes, toBytes(expected)) << text;
+    }
+}
+
+TEST(ParseValueHelperTest, ParseBase64Malformed) {
+    Base64Bytes value;
+    for (const char* text : {"Zg", "Zg=", "Zm9", "Z===", "====", "Zh==", "Zm9=", "Zm 9v", "Zm9v_w==",
+                             "Zm9vYmFyZm9vYmFyZm9vYmFyZm9vYmF!Zm9vYmFy"}) {
+        nlohmann::json jsonValue = text;
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::invalidType) << text;
+    }
+    nlohmann::json number = 42;
+    EXPECT_EQ(parseValueHelper(number, "field key", value), UnpackErrorCode::invalidType);
+}
+
+TEST(ParseValueHelperTest, ParseBase64Url) {
+    nlohmann::json jsonValue = "-_8";
+    Base64UrlBytes value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.bytes, (std::vector<std::byte>{std::byte{0xfb}, std::byte{0xff}}));
+    jsonValue = "-_8=";
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    jsonValue = "+/8=";
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::invalidType);
+}
+
+TEST(ParseValueHelperTest, ParseBase64RoundTrip) {
+    for (std::size_t size : {1, 2, 3, 23, 24, 25, 47, 48, 100, 1000, 4099}) {
+        std::vector<std::byte> bytes = randomBytes(size);
+        nlohmann::json standard = encodeBase64(bytes, false, true);
+        Base64Bytes value;
+        EXPECT_EQ(parseValueHelper(standard, "field key", value), UnpackErrorCode::success) << size;
+        EXPECT_EQ(value.bytes, bytes) << size;
+
+        nlohmann::json url = encodeBase64(bytes, true, false);
+        Base64UrlBytes urlValue;
+        EXPECT_EQ(parseValueHelper(url, "field key", urlValue), UnpackErrorCode::success) << size;
+        EXPECT_EQ(urlValue.bytes, bytes) << size;
+
+        // Every position of a long input goes through the same validation.
+        std::string corrupted = standard.get<std::string>();
+        corrupted[corrupted.size() / 2] = '*';
+        nlohmann::json bad = corrupted;
+        EXPECT_EQ(parseValueHelper(bad, "field key", value), UnpackErrorCode::invalidType) << size;
+    }
+}
+
+TEST(ParseValueHelperTest, ParseHex) {
+    nlohmann::json jsonValue = "00ff10Ab";
+    HexBytes value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.bytes, (std::vector<std::byte>{std::byte{0x00}, std::byte{0xff}, std::byte{0x10},
+                                                   std::byte{0xab}}));
+
+    std::string longHex;
+    std::vector<std::byte> expected = randomBytes(77);
+    for (std::byte byte : expected) {
+        longHex += "0123456789abcdef"[std::to_integer<int>(byte) >> 4];
+        longHex += "0123456789ABCDEF"[std::to_integer<int>(byte) & 0xf];
+    }
+    jsonValue = longHex;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.bytes, expected);
+
+    for (std::size_t i : {std::size_t{3}, std::size_t{40}, longHex.size() - 1}) {
+        std::string corrupted = longHex;
+        corrupted[i] = 'g';
+        nlohmann::json bad = corrupted;
+        EXPECT_EQ(parseValueHelper(bad, "field key", value), UnpackErrorCode::invalidType) << i;
+    }
+    jsonValue = "abc";
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::invalidType);
+}
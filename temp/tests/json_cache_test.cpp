@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include "json_cache.hpp"
+
+using namespace redfish::json_util;
+
+TEST(UnpackCacheTest, SecondLookupIsAHit) {
+    UnpackCache<std::vector<std::string>> cache(4);
+    std::shared_ptr<const std::vector<std::string>> first;
+    std::shared_ptr<const std::vector<std::string>> second;
+    EXPECT_EQ(cache.get(R"(["one", "two"])", "field key", first), UnpackErrorCode::success);
+    EXPECT_EQ(cache.get(R"(["one", "two"])", "field key", second), UnpackErrorCode::success);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(*second, std::vector<std::string>({"one", "two"}));
+    EXPECT_EQ(cache.getStats().hits, 1u);
+    EXPECT_EQ(cache.getStats().misses, 1u);
+}
+
+TEST(UnpackCacheTest, EvictsLeastRecentlyUsed) {
+    UnpackCache<uint32_t> cache(2);
+    std::shared_ptr<const uint32_t> value;
+    EXPECT_EQ(cache.get("1", "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(cache.get("2", "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(cache.get("1", "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(cache.get("3", "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(cache.get("1", "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(cache.get("2", "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(*value, 2u);
+    EXPECT_EQ(cache.getStats().hits, 2u);
+    EXPECT_EQ(cache.getStats().misses, 4u);
+}
+
+TEST(UnpackCacheTest, FailuresAreNotCached) {
+    UnpackCache<std::string> cache(4);
+    std::shared_ptr<const std::string> value;
+    EXPECT_NE(cache.get("42", "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value, nullptr);
+    EXPECT_EQ(cache.size(), 0u);
+    EXPECT_THROW(cache.get("{", "field key", value), nlohmann::json::parse_error);
+}
+
+TEST(UnpackCacheTest, ZeroCapacityPassesThrough) {
+    UnpackCache<bool> cache(0);
+    std::shared_ptr<const bool> value;
+    EXPECT_EQ(cache.get("true", "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(cache.get("true", "field key", value), UnpackErrorCode::success);
+    EXPECT_TRUE(*value);
+    EXPECT_EQ(cache.getStats().hits, 0u);
+    EXPECT_EQ(cache.size(), 0u);
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include "json_enum.hpp"
+
+using namespace redfish::json_util::details;
+
+enum class PowerState { On, Off, PoweringOn, PoweringOff, Paused };
+
+REDFISH_JSON_UNPACK_ENUM(PowerState,
+                         {"On", PowerState::On},
+                         {"Off", PowerState::Off},
+                         {"PoweringOn", PowerState::PoweringOn},
+                         {"PoweringOff", PowerState::PoweringOff},
+                         {"Paused", PowerState::Paused})
+
+enum class ResetType {
+    On, ForceOff, GracefulShutdown, GracefulRestart, ForceRestart, Nmi,
+    ForceOn, PushPowerButton, PowerCycle, Suspend, Pause, Resume,
+    FullPowerCycle, Unknown1, Unknown2, Unknown3, Unknown4, Unknown5,
+    Unknown6, Unknown7, Unknown8, Unknown9, Unknown10, Unknown11
+};
+
+REDFISH_JSON_UNPACK_ENUM(ResetType,
+                         {"On", ResetType::On},
+                         {"ForceOff", ResetType::ForceOff},
+                         {"GracefulShutdown", ResetType::GracefulShutdown},
+                         {"GracefulRestart", ResetType::GracefulRestart},
+                         {"ForceRestart", ResetType::ForceRestart},
+                         {"Nmi", ResetType::Nmi},
+                         {"ForceOn", ResetType::ForceOn},
+                         {"PushPowerButton", ResetType::PushPowerButton},
+                         {"PowerCycle", ResetType::PowerCycle},
+                         {"Suspend", ResetType::Suspend},
+                         {"Pause", ResetType::Pause},
+                         {"Resume", ResetType::Resume},
+                         {"FullPowerCycle", ResetType::FullPowerCycle},
+                         {"Unknown1", ResetType::Unknown1},
+                         {"Unknown2", ResetType::Unknown2},
+                         {"Unknown3", ResetType::Unknown3},
+                         {"Unknown4", ResetType::Unknown4},
+                         {"Unknown5", ResetType::Unknown5},
+                         {"Unknown6", ResetType::Unknown6},
+                         {"Unknown7", ResetType::Unknown7},
+                         {"Unknown8", ResetType::Unknown8},
+                         {"Unknown9", ResetType::Unknown9},
+                         {"Unknown10", ResetType::Unknown10},
+                         {"Unknown11", ResetType::Unknown11})
+
+TEST(ParseValueHelperTest, ParseEnum) {
+    nlohmann::json jsonValue = "PoweringOff";
+    PowerState value = PowerState::On;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value, PowerState::PoweringOff);
+}
+
+TEST(ParseValueHelperTest, ParseEnumEveryName) {
+    const auto& table = redfish::json_util::details::enumTable<ResetType>;
+    ASSERT_EQ(table.entries().size(), 24u);
+    for (const auto& [name, expected] : table.entries()) {
+        nlohmann::json jsonValue = name;
+        ResetType value = expected == ResetType::Nmi ? ResetType::On : ResetType::Nmi;
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success) << name;
+        EXPECT_EQ(value, expected) << name;
+    }
+}
+
+TEST(ParseValueHelperTest, ParseEnumUnknownName) {
+    nlohmann::json jsonValue = "Standby";
+    PowerState value = PowerState::Paused;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::invalidType);
+    EXPECT_EQ(value, PowerState::Paused);
+}
+
+TEST(ParseValueHelperTest, ParseEnumNotAString) {
+    nlohmann::json jsonValue = 1;
+    PowerState value = PowerState::Paused;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::invalidType);
+}
+
+TEST(EnumTableTest, LookupAtCompileTime) {
+    constexpr auto table = redfish::json_util::makeEnumTable<PowerState>(
+        {{"On", PowerState::On}, {"Off", PowerState::Off}});
+    static_assert(table.find("Off") == PowerState::Off);
+    static_assert(!table.find("off").has_value());
+    static_assert(!table.find("").has_value());
+}
+
+constexpr std::size_t largeTableSize = 4096;
+
+// "N0" through "N4095", kept in static storage for the table's string_views.
+constexpr auto largeTableNames = [] {
+    std::array<std::array<char, 8>, largeTableSize> names{};
+    for (std::size_t i = 0; i < largeTableSize; ++i) {
+        std::size_t pos = 0;
+        names[i][pos++] = 'N';
+        for (std::size_t divisor : {1000, 100, 10, 1}) {
+            if (i >= divisor || divisor == 1) {
+                names[i][pos++] = static_cast<char>('0' + i / divisor % 10);
+            }
+        }
+    }
+    return names;
+}();
+
+constexpr auto largeTable = [] {
+    std::array<redfish::json_util::EnumString<int>, largeTableSize> entries{};
+    for (std::size_t i = 0; i < largeTableSize; ++i) {
+        entries[i] = {std::string_view(largeTableNames[i].data()), static_cast<int>(i)};
+    }
+    return redfish::json_util::EnumTable<int, largeTableSize>(entries);
+}();
+
+TEST(EnumTableTest, LargestTable) {
+    static_assert(largeTable.find("N4095") == 4095);
+    for (std::size_t i = 0; i < largeTableSize; ++i) {
+        EXPECT_EQ(largeTable.find(largeTableNames[i].data()), static_cast<int>(i));
+    }
+    EXPECT_EQ(largeTable.find("N4096"), std::nullopt);
+    EXPECT_EQ(largeTable.find(""), std::nullopt);
+}
+
+TEST(ParseValueHelperTest, ParseEnumFlags) {
+    nlohmann::json jsonValue = {"On", "ForceOff", "GracefulRestart"};
+    redfish::json_util::EnumFlags<ResetType> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_TRUE(value.test(ResetType::On));
+    EXPECT_TRUE(value.test(ResetType::ForceOff));
+    EXPECT_TRUE(value.test(ResetType::GracefulRestart));
+    EXPECT_FALSE(value.test(ResetType::Nmi));
+    EXPECT_EQ(value.mask(), 0b1011u);
+}
+
+TEST(ParseValueHelperTest, ParseEnumFlagsDuplicatePolicy) {
+    using namespace redfish::json_util;
+    nlohmann::json jsonValue = {"On", "On"};
+    EnumFlags<ResetType> allowed;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", allowed), UnpackErrorCode::success);
+    EXPECT_EQ(allowed.mask(), 1u);
+    EnumFlags<ResetType, DuplicateFlags::reject> rejected;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", rejected), UnpackErrorCode::invalidType);
+}
+
+TEST(ParseValueHelperTest, ParseEnumFlagsUnknownPolicy) {
+    using namespace redfish::json_util;
+    nlohmann::json jsonValue = {"Nmi", "Hibernate"};
+    EnumFlags<ResetType> rejected;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", rejected), UnpackErrorCode::invalidType);
+    EnumFlags<ResetType, DuplicateFlags::allow, UnknownFlags::ignore> ignored;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", ignored), UnpackErrorCode::success);
+    EXPECT_TRUE(ignored.test(ResetType::Nmi));
+    EXPECT_EQ(ignored.mask(), decltype(ignored)::bit(ResetType::Nmi));
+}
+
+TEST(ParseValueHelperTest, ParseEnumFlagsNotAnArray) {
+    nlohmann::json jsonValue = "On";
+    redfish::json_util::EnumFlags<PowerState> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::invalidType);
+    nlohmann::json mixed = {"On", 1};
+    EXPECT_EQ(parseValueHelper(mixed, "field key", value), UnpackErrorCode::invalidType);
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include "json_extract.hpp"
+
+using namespace redfish::json_util;
+
+namespace {
+
+const char* body = R"({
+    "Id": "1",
+    "Members": [{"Name": "a"}, {"Name": "b", "Ports": [1, 2, 3]}],
+    "Oem": {"Vendor": {"Settings": {"Mode": "Eco", "Limits": [10, 20]}}}
+})";
+
+} // namespace
+
+TEST(ExtractValueTest, ExtractStringFromText) {
+    std::string value;
+    EXPECT_EQ(extractValue(std::string_view(body), JsonPath("/Oem/Vendor/Settings/Mode"), value), UnpackErrorCode::success);
+    EXPECT_EQ(value, "Eco");
+}
+
+TEST(ExtractValueTest, ExtractThroughArrayIndexFromText) {
+    std::vector<uint16_t> value;
+    EXPECT_EQ(extractValue(std::string_view(body), JsonPath("/Members/1/Ports"), value), UnpackErrorCode::success);
+    EXPECT_EQ(value, std::vector<uint16_t>({1, 2, 3}));
+}
+
+TEST(ExtractValueTest, ExtractObjectFromText) {
+    nlohmann::json::object_t value;
+    EXPECT_EQ(extractValue(std::string_view(body), JsonPath("/Oem/Vendor/Settings"), value), UnpackErrorCode::success);
+    EXPECT_EQ(value["Mode"], "Eco");
+    EXPECT_EQ(value["Limits"], nlohmann::json({10, 20}));
+}
+
+TEST(ExtractValueTest, ExtractWholeDocumentFromText) {
+    nlohmann::json value;
+    EXPECT_EQ(extractValue(std::string_view(body), JsonPath(""), value), UnpackErrorCode::success);
+    EXPECT_EQ(value, nlohmann::json::parse(body));
+}
+
+TEST(ExtractValueTest, ExtractFromDom) {
+    nlohmann::json root = nlohmann::json::parse(body);
+    std::optional<std::vector<int32_t>> value;
+    EXPECT_EQ(extractValue(root, JsonPath("/Oem/Vendor/Settings/Limits"), value), UnpackErrorCode::success);
+    EXPECT_EQ(value, std::optional<std::vector<int32_t>>({10, 20}));
+}
+
+TEST(ExtractValueTest, MissingPath) {
+    nlohmann::json root = nlohmann::json::parse(body);
+    std::optional<std::string> optionalValue = "stale";
+    EXPECT_EQ(extractValue(root, JsonPath("/Members/5/Name"), optionalValue), UnpackErrorCode::success);
+    EXPECT_FALSE(optionalValue.has_value());
+    std::string value;
+    EXPECT_EQ(extractValue(std::string_view(body), JsonPath("/Oem/Other"), value), UnpackErrorCode::invalidType);
+    EXPECT_EQ(extractValue(std::string_view(body), JsonPath("/Id/0"), value), UnpackErrorCode::invalidType);
+}
+
+TEST(ExtractValueTest, DuplicateKeyUsesLastValue) {
+    std::string_view duplicated = R"({"A": {"B": "first"}, "A": {"C": 1}, "X": {"Y": 1, "Y": "second"}})";
+    std::optional<std::string> value;
+    EXPECT_EQ(extractValue(duplicated, JsonPath("/A/B"), value), UnpackErrorCode::success);
+    EXPECT_FALSE(value.has_value());
+    EXPECT_EQ(extractValue(duplicated, JsonPath("/X/Y"), value), UnpackErrorCode::success);
+    EXPECT_EQ(value, "second");
+}
+
+TEST(ExtractValueTest, MalformedTextThrows) {
+    std::string value;
+    EXPECT_THROW(extractValue(std::string_view(R"({"Id": "1",)"), JsonPath("/Id"), value), nlohmann::json::parse_error);
+}
+
+TEST(JsonExtractorTest, ExtractSeveralPathsFromText) {
+    std::string id;
+    std::string secondName;
+    std::string mode;
+    std::vector<uint8_t> limits;
+    std::optional<bool> missing = true;
+    JsonExtractor extractor;
+    extractor.add(JsonPath("/Id"), id);
+    extractor.add(JsonPath("/Members/1/Name"), secondName);
+    extractor.add(JsonPath("/Oem/Vendor/Settings/Mode"), mode);
+    extractor.add(JsonPath("/Oem/Vendor/Settings/Limits"), limits);
+    extractor.add(JsonPath("/Oem/Vendor/Enabled"), missing);
+    EXPECT_EQ(extractor.extract(std::string_view(body)), UnpackErrorCode::success);
+    EXPECT_EQ(id, "1");
+    EXPECT_EQ(secondName, "b");
+    EXPECT_EQ(mode, "Eco");
+    EXPECT_EQ(limits, std::vector<uint8_t>({10, 20}));
+    EXPECT_FALSE(missing.has_value());
+}
+
+TEST(JsonExtractorTest, ExtractNestedTargetsFromText) {
+    nlohmann::json::object_t settings;
+    std::vector<int64_t> limits;
+    int64_t firstLimit = 0;
+    JsonExtractor extractor;
+    extractor.add(JsonPath("/Oem/Vendor/Settings/Limits/0"), firstLimit);
+    extractor.add(JsonPath("/Oem/Vendor/Settings"), settings);
+    extractor.add(JsonPath("/Oem/Vendor/Settings/Limits"), limits);
+    EXPECT_EQ(extractor.extract(std::string_view(body)), UnpackErrorCode::success);
+    EXPECT_EQ(settings["Mode"], "Eco");
+    EXPECT_EQ(limits, std::vector<int64_t>({10, 20}));
+    EXPECT_EQ(firstLimit, 10);
+}
+
+TEST(JsonExtractorTest, ExtractSeveralPathsFromDom) {
+    nlohmann::json root = nlohmann::json::parse(body);
+    std::string firstName;
+    std::vector<uint32_t> ports;
+    JsonExtractor extractor;
+    extractor.add(JsonPath("/Members/0/Name"), firstName);
+    extractor.add(JsonPath("/Members/1/Ports"), ports);
+    EXPECT_EQ(extractor.extract(root), UnpackErrorCode::success);
+    EXPECT_EQ(firstName, "a");
+    EXPECT_EQ(ports, std::vector<uint32_t>({1, 2, 3}));
+}
+
+TEST(JsonExtractorTest, ReturnsFirstFailure) {
+    std::string id;
+    bool mode = false;
+    JsonExtractor extractor;
+    extractor.add(JsonPath("/Id"), id);
+    extractor.add(JsonPath("/Oem/Vendor/Settings/Mode"), mode);
+    EXPECT_EQ(extractor.extract(std::string_view(body)), UnpackErrorCode::invalidType);
+    EXPECT_EQ(id, "1");
+}
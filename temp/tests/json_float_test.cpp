@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include "json_float.hpp"
+
+#include <cmath>
+#include <limits>
+
+using namespace redfish::json_util::details;
+using redfish::json_util::Floating;
+using redfish::json_util::PrecisionLoss;
+
+TEST(ParseValueHelperTest, ParseFloatRound) {
+    nlohmann::json jsonValue = 0.1;
+    Floating<float> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.value, 0.1f);
+
+    jsonValue = 16777217;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.value, 16777216.0f);
+
+    jsonValue = 1e39;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::outOfRange);
+    jsonValue = "1.5";
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::invalidType);
+}
+
+TEST(ParseValueHelperTest, ParseFloatReject) {
+    Floating<float, PrecisionLoss::reject> value;
+    for (nlohmann::json jsonValue : {nlohmann::json(0.5), nlohmann::json(-16777216), nlohmann::json(1e30f),
+                                     nlohmann::json(std::numeric_limits<int64_t>::min()),
+                                     nlohmann::json(uint64_t{1} << 63)}) {
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success) << jsonValue;
+        EXPECT_EQ(value.value, jsonValue.get<double>()) << jsonValue;
+    }
+    for (nlohmann::json jsonValue : {nlohmann::json(0.1), nlohmann::json(16777217), nlohmann::json(-16777217),
+                                     nlohmann::json(std::numeric_limits<uint64_t>::max()), nlohmann::json(1e39),
+                                     nlohmann::json(1e-50)}) {
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::outOfRange) << jsonValue;
+    }
+}
+
+TEST(ParseValueHelperTest, ParseFloatTopOfRange) {
+    constexpr float max = std::numeric_limits<float>::max();
+    Floating<float> value;
+    for (double number : {3.4028235e38, -3.4028235e38, static_cast<double>(max)}) {
+        nlohmann::json jsonValue = number;
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success) << number;
+        EXPECT_EQ(value.value, number > 0 ? max : -max) << number;
+    }
+
+    // max() plus half an ulp rounds to infinity; anything below it does not.
+    double threshold = std::ldexp(1.0, 128) - std::ldexp(1.0, 103);
+    nlohmann::json jsonValue = std::nextafter(threshold, 0.0);
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.value, max);
+    jsonValue = threshold;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::outOfRange);
+    jsonValue = -threshold;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::outOfRange);
+
+    Floating<float, PrecisionLoss::reject> exact;
+    jsonValue = static_cast<double>(-max);
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", exact), UnpackErrorCode::success);
+    jsonValue = 3.4028235e38;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", exact), UnpackErrorCode::outOfRange);
+}
+
+TEST(ParseValueHelperTest, ParseFloatSaturate) {
+    nlohmann::json jsonValue = 1e39;
+    Floating<float, PrecisionLoss::saturate> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.value, std::numeric_limits<float>::max());
+    jsonValue = -1e300;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.value, std::numeric_limits<float>::lowest());
+    jsonValue = 2.5;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.value, 2.5f);
+}
+
+TEST(ParseValueHelperTest, ParseLongDouble) {
+    nlohmann::json jsonValue = 0.1;
+    Floating<long double, PrecisionLoss::reject> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.value, static_cast<long double>(0.1));
+
+    jsonValue = int64_t{-9007199254740993};
+    Floating<long double> rounded;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", rounded), UnpackErrorCode::success);
+    EXPECT_EQ(rounded.value, static_cast<long double>(int64_t{-9007199254740993}));
+}
+
+TEST(ParseValueHelperTest, ParseFloatInsideOptionalAndVector) {
+    nlohmann::json jsonValue = {1.5, 2, -0.25};
+    std::optional<std::vector<Floating<float>>> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    ASSERT_TRUE(value.has_value());
+    ASSERT_EQ(value->size(), 3u);
+    EXPECT_EQ((*value)[1].value, 2.0f);
+    EXPECT_EQ((*value)[2].value, -0.25f);
+}
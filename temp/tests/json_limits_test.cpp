@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include "json_limits.hpp"
+
+using namespace redfish::json_util;
+
+TEST(UnpackLimitsTest, WithinLimits) {
+    UnpackLimits limits;
+    std::vector<std::string> value;
+    EXPECT_EQ(unpackWithLimits(R"(["a", "b", "c"])", limits, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value, std::vector<std::string>({"a", "b", "c"}));
+}
+
+TEST(UnpackLimitsTest, Depth) {
+    UnpackLimits limits;
+    limits.maxDepth = 3;
+    nlohmann::json document;
+    EXPECT_EQ(parseWithLimits("[[[1]]]", limits, document), UnpackErrorCode::success);
+    EXPECT_EQ(parseWithLimits("[[[[1]]]]", limits, document), UnpackErrorCode::outOfRange);
+    EXPECT_EQ(parseWithLimits(R"({"a": {"b": [{}]}})", limits, document), UnpackErrorCode::outOfRange);
+}
+
+TEST(UnpackLimitsTest, ArrayLength) {
+    UnpackLimits limits;
+    limits.maxArrayLength = 3;
+    nlohmann::json document;
+    EXPECT_EQ(parseWithLimits(R"([1, [2, 3, 4], {"a": [5]}])", limits, document), UnpackErrorCode::success);
+    EXPECT_EQ(parseWithLimits("[1, 2, 3, 4]", limits, document), UnpackErrorCode::outOfRange);
+    EXPECT_EQ(parseWithLimits("[[], [], {}, []]", limits, document), UnpackErrorCode::outOfRange);
+}
+
+TEST(UnpackLimitsTest, MemberCount) {
+    UnpackLimits limits;
+    limits.maxMembers = 2;
+    nlohmann::json document;
+    EXPECT_EQ(parseWithLimits(R"({"a": 1, "b": {"c": 2, "d": 3}})", limits, document), UnpackErrorCode::success);
+    EXPECT_EQ(parseWithLimits(R"({"a": 1, "b": 2, "c": 3})", limits, document), UnpackErrorCode::outOfRange);
+}
+
+TEST(UnpackLimitsTest, StringBytes) {
+    UnpackLimits limits;
+    limits.maxStringBytes = 8;
+    nlohmann::json document;
+    EXPECT_EQ(parseWithLimits(R"({"ab": "cdef", "g": ["h"]})", limits, document), UnpackErrorCode::success);
+    EXPECT_EQ(parseWithLimits(R"({"ab": "cdef", "gh": ["i"]})", limits, document), UnpackErrorCode::outOfRange);
+}
+
+TEST(UnpackLimitsTest, DuplicateKeys) {
+    UnpackLimits limits;
+    nlohmann::json document;
+    EXPECT_EQ(parseWithLimits(R"({"a": 1, "b": {"a": 2}})", limits, document), UnpackErrorCode::success);
+    EXPECT_EQ(parseWithLimits(R"({"a": 1, "b": 2, "a": 3})", limits, document), UnpackErrorCode::outOfRange);
+
+    limits.rejectDuplicateKeys = false;
+    EXPECT_EQ(parseWithLimits(R"({"a": 1, "b": 2, "a": 3})", limits, document), UnpackErrorCode::success);
+    EXPECT_EQ(document["a"], 3);
+}
+
+TEST(UnpackLimitsTest, StopsAtFirstViolation) {
+    UnpackLimits limits;
+    limits.maxArrayLength = 2;
+    nlohmann::json document;
+    // The violation comes before the syntax error, so the parse never gets
+    // that far.
+    EXPECT_EQ(parseWithLimits("[1, 2, 3, oops", limits, document), UnpackErrorCode::outOfRange);
+    EXPECT_THROW(parseWithLimits("[1, oops", limits, document), nlohmann::json::parse_error);
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include "json_map.hpp"
+
+using namespace redfish::json_util::details;
+using redfish::json_util::SortedMap;
+
+TEST(ParseValueHelperTest, ParseUnorderedMap) {
+    nlohmann::json jsonValue = nlohmann::json::object();
+    for (int i = 0; i < 5000; ++i) {
+        jsonValue["Sensor" + std::to_string(i)] = i;
+    }
+    std::unordered_map<std::string, int64_t> value = {{"Stale", 1}};
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.size(), 5000u);
+    EXPECT_EQ(value.at("Sensor4321"), 4321);
+    EXPECT_FALSE(value.contains("Stale"));
+}
+
+TEST(ParseValueHelperTest, ParseMap) {
+    nlohmann::json jsonValue = {{"b", {"x", "y"}}, {"a", nlohmann::json::array()}, {"c", {"z"}}};
+    std::map<std::string, std::vector<std::string>> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value, (std::map<std::string, std::vector<std::string>>{{"a", {}}, {"b", {"x", "y"}}, {"c", {"z"}}}));
+}
+
+TEST(ParseValueHelperTest, ParseNestedMaps) {
+    nlohmann::json jsonValue = {{"Oem", {{"Enabled", true}}}, {"Vendor", {{"Enabled", false}, {"Debug", true}}}};
+    std::unordered_map<std::string, std::map<std::string, bool>> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_TRUE(value.at("Oem").at("Enabled"));
+    EXPECT_TRUE(value.at("Vendor").at("Debug"));
+    EXPECT_FALSE(value.at("Vendor").at("Enabled"));
+}
+
+TEST(ParseValueHelperTest, ParseMapErrors) {
+    std::map<std::string, int64_t> ordered;
+    std::unordered_map<std::string, int64_t> hashed;
+    SortedMap<int64_t> sorted;
+    for (nlohmann::json jsonValue : {nlohmann::json::array({1, 2}), nlohmann::json(3),
+                                     nlohmann::json{{"a", 1}, {"b", "two"}}}) {
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", ordered), UnpackErrorCode::invalidType) << jsonValue;
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", hashed), UnpackErrorCode::invalidType) << jsonValue;
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", sorted), UnpackErrorCode::invalidType) << jsonValue;
+    }
+}
+
+TEST(ParseValueHelperTest, ParseSortedMap) {
+    nlohmann::json jsonValue = {{"Fan3", 3000}, {"Fan1", 1000}, {"Fan2", 2000}};
+    SortedMap<int64_t> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    ASSERT_EQ(value.size(), 3u);
+    EXPECT_EQ(value.begin()->first, "Fan1");
+    ASSERT_NE(value.find("Fan2"), nullptr);
+    EXPECT_EQ(*value.find("Fan2"), 2000);
+    EXPECT_FALSE(value.contains("Fan4"));
+
+    nlohmann::json list = {{{"a", 1}}, nlohmann::json::object()};
+    std::optional<std::vector<SortedMap<int64_t>>> nested;
+    EXPECT_EQ(parseValueHelper(list, "field key", nested), UnpackErrorCode::success);
+    ASSERT_TRUE(nested.has_value());
+    ASSERT_EQ(nested->size(), 2u);
+    EXPECT_TRUE((*nested)[0].contains("a"));
+    EXPECT_TRUE((*nested)[1].empty());
+}
+
+TEST(ParseValueHelperTest, ParseMapWrappersInsideOptionalAndVector) {
+    nlohmann::json jsonValue = {{"Fan1", 1000}, {"Fan2", 2000}};
+    std::optional<redfish::json_util::HashMap<int64_t>> hashed;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", hashed), UnpackErrorCode::success);
+    ASSERT_TRUE(hashed.has_value());
+    EXPECT_EQ(hashed->value.at("Fan2"), 2000);
+
+    nlohmann::json list = {{{"b", "x"}, {"a", "y"}}, nlohmann::json::object()};
+    std::vector<redfish::json_util::OrderedMap<std::string>> ordered;
+    EXPECT_EQ(parseValueHelper(list, "field key", ordered), UnpackErrorCode::success);
+    ASSERT_EQ(ordered.size(), 2u);
+    EXPECT_EQ(ordered[0].value.begin()->first, "a");
+    EXPECT_EQ(ordered[0].value.find(std::string_view("b"))->second, "x");
+    EXPECT_TRUE(ordered[1].value.empty());
+
+    list = {{{"a", 1}}, 2};
+    EXPECT_EQ(parseValueHelper(list, "field key", ordered), UnpackErrorCode::invalidType);
+}
+
+TEST(ParseValueHelperTest, ParseObjectUnchangedByMapOverloads) {
+    // object_t has the shape of std::map<std::string, json, std::less<>> but
+    // must still go through the core overload.
+    static_assert(!StringKeyedMap<nlohmann::json::object_t>);
+    static_assert(StringKeyedMap<std::map<std::string, nlohmann::json>>);
+    nlohmann::json jsonValue = {{"a", 1}, {"b", {1, 2}}};
+    nlohmann::json::object_t value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value, jsonValue.get<nlohmann::json::object_t>());
+
+    redfish::json_util::OrderedMap<nlohmann::json> wrapped;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", wrapped), UnpackErrorCode::success);
+    EXPECT_EQ(wrapped.value.at("b"), nlohmann::json({1, 2}));
+}
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include "json_matrix.hpp"
+
+using namespace redfish::json_util::details;
+using redfish::json_util::Matrix;
+
+TEST(ParseValueHelperTest, ParseMatrix) {
+    nlohmann::json jsonValue = {{1760000000, 21.5}, {1760000060, 22}, {1760000120, 22.25}};
+    Matrix<double> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    ASSERT_EQ(value.rows(), 3u);
+    ASSERT_EQ(value.columns(), 2u);
+    EXPECT_EQ(value(1, 0), 1760000060.0);
+    EXPECT_EQ(value(2, 1), 22.25);
+    EXPECT_EQ(value.row(1)[1], 22.0);
+    EXPECT_EQ(value.data().size(), 6u);
+    EXPECT_EQ(value.data()[4], 1760000120.0);
+}
+
+TEST(ParseValueHelperTest, ParseMatrixEmpty) {
+    nlohmann::json jsonValue = nlohmann::json::array();
+    Matrix<int64_t> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.rows(), 0u);
+    EXPECT_EQ(value.columns(), 0u);
+
+    jsonValue = {nlohmann::json::array(), nlohmann::json::array()};
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.rows(), 2u);
+    EXPECT_EQ(value.columns(), 0u);
+}
+
+TEST(ParseValueHelperTest, ParseMatrixShapeErrors) {
+    nlohmann::json good = {{1, 2}, {3, 4}};
+    Matrix<int64_t> value;
+    ASSERT_EQ(parseValueHelper(good, "field key", value), UnpackErrorCode::success);
+    for (nlohmann::json jsonValue : {nlohmann::json{{1, 2}, {3}}, nlohmann::json{{1, 2}, {3, 4, 5}},
+                                     nlohmann::json::array({1, 2}), nlohmann::json{{"a", 1}},
+                                     nlohmann::json{{1, 2}, {3, "four"}}}) {
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::invalidType) << jsonValue;
+    }
+    // A failed decode leaves the previous contents alone.
+    EXPECT_EQ(value(1, 1), 4);
+}
+
+TEST(ParseValueHelperTest, ParseMatrixInsideOptionalAndVector) {
+    nlohmann::json jsonValue = {{{1.0, 2.0}}, {{3.0}, {4.0}}};
+    std::optional<std::vector<Matrix<double>>> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    ASSERT_TRUE(value.has_value());
+    ASSERT_EQ(value->size(), 2u);
+    EXPECT_EQ((*value)[0].columns(), 2u);
+    EXPECT_EQ((*value)[1].rows(), 2u);
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include "json_network.hpp"
+
+using namespace redfish::json_util::details;
+using redfish::json_util::Ipv4Address;
+using redfish::json_util::Ipv6Address;
+using redfish::json_util::MacAddress;
+
+TEST(ParseValueHelperTest, ParseIpv4Address) {
+    nlohmann::json jsonValue = "192.168.0.1";
+    Ipv4Address value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.bytes, (std::array<uint8_t, 4>{192, 168, 0, 1}));
+    EXPECT_EQ(value.toUint32(), 0xc0a80001u);
+}
+
+TEST(ParseValueHelperTest, ParseIpv4AddressMalformed) {
+    Ipv4Address value;
+    for (const char* text : {"", "1.2.3", "1.2.3.4.5", "256.0.0.1", "01.2.3.4", "1..3.4",
+                             "1.2.3.4 ", "a.b.c.d", "1.2.3.1000"}) {
+        nlohmann::json jsonValue = text;
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::invalidType) << text;
+    }
+    nlohmann::json number = 3232235521;
+    EXPECT_EQ(parseValueHelper(number, "field key", value), UnpackErrorCode::invalidType);
+}
+
+TEST(ParseValueHelperTest, ParseIpv6Address) {
+    const std::pair<const char*, std::array<uint8_t, 16>> cases[] = {
+        {"::", {}},
+        {"::1", {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}},
+        {"fe80::", {0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}},
+        {"2001:DB8::8:800:200c:417a",
+         {0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0x08, 0x08, 0, 0x20, 0x0c, 0x41, 0x7a}},
+        {"1:2:3:4:5:6:7:8", {0, 1, 0, 2, 0, 3, 0, 4, 0, 5, 0, 6, 0, 7, 0, 8}},
+        {"::ffff:192.0.2.128", {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff, 192, 0, 2, 128}}};
+    for (const auto& [text, bytes] : cases) {
+        nlohmann::json jsonValue = text;
+        Ipv6Address value;
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success) << text;
+        EXPECT_EQ(value.bytes, bytes) << text;
+    }
+}
+
+TEST(ParseValueHelperTest, ParseIpv6AddressMalformed) {
+    Ipv6Address value;
+    for (const char* text : {"", ":", ":1", "1:", "1::2::3", "12345::", "1:2:3:4:5:6:7:8:9",
+                             "1:2:3:4:5:6:7:8::", "::1:2:3:4:5:6:7:8", "1:2:3:4:5:6:7",
+                             "fe80::1%eth0", "::1.2.3", "1.2.3.4", "g::"}) {
+        nlohmann::json jsonValue = text;
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::invalidType) << text;
+    }
+}
+
+TEST(ParseValueHelperTest, ParseMacAddress) {
+    nlohmann::json jsonValue = "00:1A:2b:3c:4D:ff";
+    MacAddress value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.bytes, (std::array<uint8_t, 6>{0x00, 0x1a, 0x2b, 0x3c, 0x4d, 0xff}));
+
+    for (const char* text : {"00-1a-2b-3c-4d-ff", "00:1a:2b:3c:4d:fg", "001a2b3c4dff", "00:1a:2b:3c:4d"}) {
+        nlohmann::json other = text;
+        EXPECT_EQ(parseValueHelper(other, "field key", value),
+                  text[2] == '-' ? UnpackErrorCode::success : UnpackErrorCode::invalidType) << text;
+    }
+}
+
+TEST(ParseValueHelperTest, ParseOptionalVectorIpv4Address) {
+    nlohmann::json jsonValue = {"10.0.0.1", "10.0.0.2"};
+    std::optional<std::vector<Ipv4Address>> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    ASSERT_TRUE(value.has_value());
+    ASSERT_EQ(value->size(), 2u);
+    EXPECT_EQ((*value)[1].toUint32(), 0x0a000002u);
+}
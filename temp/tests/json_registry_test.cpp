@@ -0,0 +1,26 @@
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include "json_registry.hpp"
+
+using namespace redfish::json_util::details;
+using redfish::json_util::isRegisteredDestination;
+using redfish::json_util::unpackRegistered;
+
+static_assert(isRegisteredDestination<uint8_t>);
+static_assert(isRegisteredDestination<std::optional<std::variant<int32_t, std::nullptr_t>>>);
+static_assert(!isRegisteredDestination<float>);
+static_assert(!isRegisteredDestination<void>);
+
+TEST(RegistryTest, UnpackRegistered) {
+    nlohmann::json jsonValue = {"a", nullptr, {{"b", 1}}};
+    std::optional<std::vector<std::variant<std::string, nlohmann::json::object_t, std::nullptr_t>>> value;
+    EXPECT_EQ(unpackRegistered(jsonValue, "field key", value), UnpackErrorCode::success);
+    ASSERT_TRUE(value.has_value());
+    ASSERT_EQ(value->size(), 3u);
+    EXPECT_EQ(std::get<std::string>((*value)[0]), "a");
+    EXPECT_TRUE(std::holds_alternative<std::nullptr_t>((*value)[1]));
+
+    jsonValue = 300;
+    uint8_t byte = 0;
+    EXPECT_EQ(unpackRegistered(jsonValue, "field key", byte), UnpackErrorCode::outOfRange);
+}
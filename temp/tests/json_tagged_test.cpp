@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include "json_tagged.hpp"
+
+using namespace redfish::json_util::details;
+using redfish::json_util::ODataVariant;
+using redfish::json_util::TaggedVariant;
+
+namespace resources {
+
+struct Chassis {
+    static constexpr std::string_view discriminator = "#Chassis.Chassis";
+    std::string chassisType;
+};
+
+struct Manager {
+    static constexpr std::string_view discriminator = "#Manager.Manager";
+    std::string managerType;
+};
+
+struct ManagerCollection {
+    static constexpr std::string_view discriminator = "#ManagerCollection.ManagerCollection";
+    int64_t count = 0;
+};
+
+// Decodes one named member, standing in for a generated resource reader.
+template <typename Type>
+redfish::json_util::UnpackErrorCode parseMember(nlohmann::json& jsonValue, const char* name, Type& value) {
+    auto member = jsonValue.find(name);
+    if (member == jsonValue.end()) {
+        return redfish::json_util::UnpackErrorCode::invalidType;
+    }
+    return redfish::json_util::details::parseValueHelper(*member, name, value);
+}
+
+redfish::json_util::UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue, std::string_view, Chassis& value) {
+    return parseMember(jsonValue, "ChassisType", value.chassisType);
+}
+
+redfish::json_util::UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue, std::string_view, Manager& value) {
+    return parseMember(jsonValue, "ManagerType", value.managerType);
+}
+
+redfish::json_util::UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue, std::string_view,
+                                                     ManagerCollection& value) {
+    return parseMember(jsonValue, "Members@odata.count", value.count);
+}
+
+struct Disk {
+    static constexpr std::string_view discriminator = "disk";
+    int64_t capacity = 0;
+};
+
+struct Nic {
+    static constexpr std::string_view discriminator = "nic";
+    std::string mac;
+};
+
+redfish::json_util::UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue, std::string_view, Disk& value) {
+    return parseMember(jsonValue, "capacity", value.capacity);
+}
+
+redfish::json_util::UnpackErrorCode parseValueHelper(nlohmann::json& jsonValue, std::string_view, Nic& value) {
+    return parseMember(jsonValue, "mac", value.mac);
+}
+
+} // namespace resources
+
+using Resource = ODataVariant<resources::Chassis, resources::Manager, resources::ManagerCollection>;
+
+TEST(TaggedVariantTest, SelectsByODataType) {
+    nlohmann::json jsonValue = {{"@odata.type", "#Manager.v1_19_0.Manager"}, {"ManagerType", "BMC"}};
+    Resource value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    ASSERT_TRUE(std::holds_alternative<resources::Manager>(value.value));
+    EXPECT_EQ(std::get<resources::Manager>(value.value).managerType, "BMC");
+
+    jsonValue = {{"@odata.type", "#ManagerCollection.ManagerCollection"}, {"Members@odata.count", 2}};
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    ASSERT_TRUE(std::holds_alternative<resources::ManagerCollection>(value.value));
+    EXPECT_EQ(std::get<resources::ManagerCollection>(value.value).count, 2);
+}
+
+TEST(TaggedVariantTest, RejectsUnknownOrMissingTag) {
+    Resource value;
+    for (const nlohmann::json& jsonValue :
+         {nlohmann::json{{"@odata.type", "#Thermal.v1_0_0.Thermal"}}, nlohmann::json{{"ChassisType", "Rack"}},
+          nlohmann::json{{"@odata.type", 3}}, nlohmann::json{{"@odata.type", "#Chassis.v1_0_0"}},
+          nlohmann::json::array({"#Chassis.Chassis"}), nlohmann::json("#Chassis.Chassis")}) {
+        nlohmann::json copy = jsonValue;
+        EXPECT_EQ(parseValueHelper(copy, "field key", value), UnpackErrorCode::invalidType) << jsonValue;
+    }
+}
+
+TEST(TaggedVariantTest, PropagatesAlternativeError) {
+    nlohmann::json jsonValue = {{"@odata.type", "#Chassis.v1_25_0.Chassis"}, {"ChassisType", 7}};
+    Resource value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::invalidType);
+}
+
+TEST(TaggedVariantTest, CustomTagInsideVector) {
+    nlohmann::json jsonValue = {{{"kind", "nic"}, {"mac", "00:11:22:33:44:55"}},
+                                {{"kind", "disk"}, {"capacity", 512}}};
+    std::vector<TaggedVariant<"kind", resources::Disk, resources::Nic>> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    ASSERT_EQ(value.size(), 2u);
+    EXPECT_EQ(std::get<resources::Nic>(value[0].value).mac, "00:11:22:33:44:55");
+    EXPECT_EQ(std::get<resources::Disk>(value[1].value).capacity, 512);
+
+    // Version stripping only applies to @odata.type.
+    jsonValue = nlohmann::json::array({{{"kind", "nic.v1_0_0.x"}, {"mac", ""}}});
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::invalidType);
+}
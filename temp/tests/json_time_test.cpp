@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include "json_time.hpp"
+
+using namespace redfish::json_util::details;
+using redfish::json_util::DateTime;
+using redfish::json_util::IsoDuration;
+using namespace std::chrono;
+
+TEST(ParseValueHelperTest, ParseDateTimeUtc) {
+    nlohmann::json jsonValue = "2026-10-17T12:00:00Z";
+    DateTime<> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.value, sys_days(2026y / October / 17) + 12h);
+}
+
+TEST(ParseValueHelperTest, ParseDateTimeOffset) {
+    nlohmann::json jsonValue = "2026-10-17T12:00:00+02:30";
+    DateTime<> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.value, sys_days(2026y / October / 17) + 9h + 30min);
+
+    jsonValue = "2026-12-31T23:30:00-01:00";
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.value, sys_days(2027y / January / 1) + 30min);
+}
+
+TEST(ParseValueHelperTest, ParseDateTimeFraction) {
+    nlohmann::json jsonValue = "1969-12-31T23:59:59.1234567891+00:00";
+    DateTime<milliseconds> millis;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", millis), UnpackErrorCode::success);
+    EXPECT_EQ(millis.value.time_since_epoch(), -877ms);
+    DateTime<nanoseconds> nanos;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", nanos), UnpackErrorCode::success);
+    EXPECT_EQ(nanos.value.time_since_epoch(), -876543211ns);
+}
+
+TEST(ParseValueHelperTest, ParseDateTimeMalformed) {
+    DateTime<> value;
+    for (const char* text : {"2026-10-17 12:00:00Z", "2026-10-17T12:00:00", "2026-1O-17T12:00:00Z",
+                             "2026-10-17T12:00:00.Z", "2026-10-17T12:00:00+0200", "2026-10-17T12:00:00Zx",
+                             "2026-10-17", ""}) {
+        nlohmann::json jsonValue = text;
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::invalidType) << text;
+    }
+    nlohmann::json number = 1760702400;
+    EXPECT_EQ(parseValueHelper(number, "field key", value), UnpackErrorCode::invalidType);
+}
+
+TEST(ParseValueHelperTest, ParseDateTimeOutOfRange) {
+    DateTime<> value;
+    for (const char* text : {"2026-02-29T00:00:00Z", "2026-13-01T00:00:00Z", "2026-10-17T24:00:00Z",
+                             "2026-10-17T12:60:00Z", "2026-10-17T12:00:60Z", "2026-10-17T12:00:00+24:00"}) {
+        nlohmann::json jsonValue = text;
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::outOfRange) << text;
+    }
+}
+
+TEST(ParseValueHelperTest, ParseIsoDuration) {
+    IsoDuration<> value;
+    nlohmann::json jsonValue = "PT5M";
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.value, 5min);
+
+    jsonValue = "P1DT2H3M4S";
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.value, 24h + 2h + 3min + 4s);
+
+    jsonValue = "-P2D";
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.value, -48h);
+
+    IsoDuration<milliseconds> millis;
+    jsonValue = "PT0.25S";
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", millis), UnpackErrorCode::success);
+    EXPECT_EQ(millis.value, 250ms);
+}
+
+TEST(ParseValueHelperTest, ParseIsoDurationMalformed) {
+    IsoDuration<> value;
+    for (const char* text : {"", "P", "PT", "P1DT", "5M", "P5M", "PT5D", "P1Y", "P1W", "PT1S2M",
+                             "PT1M1M", "PT1.5M", "PT1.S", "PTT1S", "PT1"}) {
+        nlohmann::json jsonValue = text;
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::invalidType) << text;
+    }
+    nlohmann::json jsonValue = "P9999999999999D";
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::outOfRange);
+}
+
+TEST(ParseValueHelperTest, ParseDateTimeNarrowRep) {
+    DateTime<duration<int32_t>> value;
+    nlohmann::json jsonValue = "2038-01-19T03:14:07.5Z";
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.value.time_since_epoch().count(), INT32_MAX);
+
+    jsonValue = "1901-12-13T20:45:52Z";
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.value.time_since_epoch().count(), INT32_MIN);
+
+    for (const char* text : {"2038-01-19T03:14:08Z", "1901-12-13T20:45:51Z", "9999-12-31T23:59:59Z"}) {
+        jsonValue = text;
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::outOfRange) << text;
+    }
+
+    DateTime<nanoseconds> nanos;
+    jsonValue = "2262-04-11T23:47:16.854775807Z";
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", nanos), UnpackErrorCode::success);
+    EXPECT_EQ(nanos.value.time_since_epoch(), nanoseconds::max());
+    jsonValue = "2262-04-11T23:47:16.854775808Z";
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", nanos), UnpackErrorCode::outOfRange);
+}
+
+TEST(ParseValueHelperTest, ParseIsoDurationNarrowRep) {
+    IsoDuration<duration<int32_t>> value;
+    nlohmann::json jsonValue = "PT2147483647.9S";
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.value.count(), INT32_MAX);
+
+    jsonValue = "-PT2147483647S";
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.value.count(), -INT32_MAX);
+
+    for (const char* text : {"P999999D", "PT2147483648S", "-P24856D"}) {
+        jsonValue = text;
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::outOfRange) << text;
+    }
+
+    // A period longer than a second keeps whole units only.
+    IsoDuration<duration<int16_t, std::ratio<86400>>> daysValue;
+    jsonValue = "P32767DT23H";
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", daysValue), UnpackErrorCode::success);
+    EXPECT_EQ(daysValue.value.count(), INT16_MAX);
+    jsonValue = "P32768D";
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", daysValue), UnpackErrorCode::outOfRange);
+}
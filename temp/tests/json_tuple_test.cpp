@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include "json_tuple.hpp"
+
+using namespace redfish::json_util::details;
+using redfish::json_util::Record;
+
+TEST(ParseValueHelperTest, ParseRecord) {
+    nlohmann::json jsonValue = {1760000000, 42.5, "OK"};
+    Record<int64_t, double, std::string> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.value, std::make_tuple(int64_t{1760000000}, 42.5, std::string("OK")));
+}
+
+TEST(ParseValueHelperTest, ParseRecordArityMismatch) {
+    Record<int64_t, double, std::string> value;
+    for (nlohmann::json jsonValue : {nlohmann::json::array({1, 2.0}), nlohmann::json::array({1, 2.0, "OK", 4}),
+                                     nlohmann::json::array(), nlohmann::json{{"a", 1}}}) {
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::invalidType) << jsonValue;
+    }
+}
+
+TEST(ParseValueHelperTest, ParseRecordElementError) {
+    nlohmann::json jsonValue = {1, "not a number", "OK"};
+    Record<int64_t, double, std::string> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::invalidType);
+
+    jsonValue = {-1, 2};
+    Record<uint8_t, uint8_t> bytes;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", bytes), UnpackErrorCode::outOfRange);
+}
+
+TEST(ParseValueHelperTest, ParseRecordRows) {
+    nlohmann::json jsonValue = {{1760000000, 21.5, "OK"}, {1760000060, 22.0, "Warning"}};
+    std::vector<Record<int64_t, double, std::string>> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    ASSERT_EQ(value.size(), 2u);
+    EXPECT_EQ(std::get<0>(value[1].value), 1760000060);
+    EXPECT_EQ(std::get<2>(value[1].value), "Warning");
+
+    jsonValue = {{1760000000, 21.5, "OK"}, {1760000060, 22.0}};
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::invalidType);
+}
+
+TEST(ParseValueHelperTest, ParseNestedRecords) {
+    nlohmann::json jsonValue = {{1, true}, {"Temperature", {1.5, -2.0}}};
+    std::optional<Record<Record<int64_t, bool>, Record<std::string, std::vector<double>>>> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(std::get<0>(value->value).value, std::make_tuple(int64_t{1}, true));
+    EXPECT_EQ(std::get<1>(std::get<1>(value->value).value), (std::vector<double>{1.5, -2.0}));
+}
+
+TEST(ParseValueHelperTest, ParseTupleAndPair) {
+    nlohmann::json jsonValue = {1760000000, 42.5, "OK"};
+    std::tuple<int64_t, double, std::string> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value, std::make_tuple(int64_t{1760000000}, 42.5, std::string("OK")));
+
+    jsonValue = {"Temperature", 21.5};
+    std::pair<std::string, double> reading;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", reading), UnpackErrorCode::success);
+    EXPECT_EQ(reading, std::make_pair(std::string("Temperature"), 21.5));
+
+    jsonValue = {"Temperature", 21.5, "extra"};
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", reading), UnpackErrorCode::invalidType);
+    jsonValue = {-1, 2};
+    std::pair<uint8_t, uint8_t> bytes;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", bytes), UnpackErrorCode::outOfRange);
+}
+
+TEST(ParseValueHelperTest, ParseNestedTuplesAndRecords) {
+    nlohmann::json jsonValue = {{1, true}, {2, {"Fan", 3000}}};
+    std::tuple<std::pair<int64_t, bool>, std::tuple<int64_t, std::pair<std::string, int64_t>>> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(std::get<0>(value), std::make_pair(int64_t{1}, true));
+    EXPECT_EQ(std::get<1>(std::get<1>(value)), std::make_pair(std::string("Fan"), int64_t{3000}));
+
+    // A Record can hold std::pair and std::tuple positions, and vice versa.
+    jsonValue = {{"Fan", 3000}, {1, {true, 2.5}}};
+    std::vector<Record<std::pair<std::string, int64_t>, std::tuple<int64_t, Record<bool, double>>>> rows;
+    nlohmann::json rowsValue = nlohmann::json::array({jsonValue, jsonValue});
+    EXPECT_EQ(parseValueHelper(rowsValue, "field key", rows), UnpackErrorCode::success);
+    ASSERT_EQ(rows.size(), 2u);
+    EXPECT_EQ(std::get<0>(rows[1].value).second, 3000);
+    EXPECT_EQ(std::get<1>(std::get<1>(rows[1].value)).value, std::make_tuple(true, 2.5));
+}
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include "json_uuid.hpp"
+
+#include <map>
+#include <unordered_set>
+
+using namespace redfish::json_util::details;
+using redfish::json_util::Uuid;
+
+TEST(ParseValueHelperTest, ParseUuid) {
+    nlohmann::json jsonValue = "123e4567-E89B-12d3-a456-426614174000";
+    Uuid value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    EXPECT_EQ(value.bytes, (std::array<uint8_t, 16>{0x12, 0x3e, 0x45, 0x67, 0xe8, 0x9b, 0x12, 0xd3,
+                                                    0xa4, 0x56, 0x42, 0x66, 0x14, 0x17, 0x40, 0x00}));
+    EXPECT_EQ(value.toString(), "123e4567-e89b-12d3-a456-426614174000");
+}
+
+TEST(ParseValueHelperTest, ParseUuidMalformed) {
+    Uuid value;
+    for (const char* text : {"", "123e4567e89b12d3a456426614174000", "{123e4567-e89b-12d3-a456-426614174000}",
+                             "123e4567-e89b-12d3-a456-42661417400", "123e4567-e89b-12d3-a456-4266141740000",
+                             "123e4567-e89b_12d3-a456-426614174000", "123e456g-e89b-12d3-a456-426614174000",
+                             "123e4567-e89b-12d3-a456-42661417400z", "123e4567-e8-b-12d3-a456-426614174000"}) {
+        nlohmann::json jsonValue = text;
+        EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::invalidType) << text;
+    }
+    nlohmann::json number = 42;
+    EXPECT_EQ(parseValueHelper(number, "field key", value), UnpackErrorCode::invalidType);
+}
+
+TEST(ParseValueHelperTest, ParseUuidContainers) {
+    nlohmann::json jsonValue = {"00000000-0000-0000-0000-000000000001", "00000000-0000-0000-0000-000000000002",
+                                "00000000-0000-0000-0000-000000000001"};
+    std::optional<std::vector<Uuid>> value;
+    EXPECT_EQ(parseValueHelper(jsonValue, "field key", value), UnpackErrorCode::success);
+    ASSERT_TRUE(value.has_value());
+    ASSERT_EQ(value->size(), 3u);
+
+    std::unordered_set<Uuid> unique(value->begin(), value->end());
+    EXPECT_EQ(unique.size(), 2u);
+    std::map<Uuid, int> ordered;
+    for (const Uuid& uuid : *value) {
+        ++ordered[uuid];
+    }
+    EXPECT_EQ(ordered.begin()->second, 2);
+    EXPECT_LT((*value)[0], (*value)[1]);
+}
+
+TEST(ParseValueHelperTest, UuidOrderMatchesText) {
+    Uuid low;
+    Uuid high;
+    ASSERT_TRUE(redfish::json_util::parseUuid("00ffffff-ffff-ffff-ffff-ffffffffffff", low));
+    ASSERT_TRUE(redfish::json_util::parseUuid("01000000-0000-0000-0000-000000000000", high));
+    EXPECT_LT(low, high);
+    EXPECT_LT(low.toString(), high.toString());
+}